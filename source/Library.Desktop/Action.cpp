@@ -11,6 +11,11 @@ namespace Library
 		Populate();
 	}
 
+	bool Action::IsParallelSafe() const
+	{
+		return false;
+	}
+
 	const std::string& Action::Name() const
 	{
 		return mName;
@@ -37,6 +37,22 @@ namespace Library
 		*/
 		virtual void Update(WorldState& state) = 0;
 
+		/**
+		* Returns whether the Action can run at the same time as Actions of other Entities. A
+		* parallel-safe Action only touches its own Entity and the WorldState it is given, or
+		* synchronizes anything else it shares. Actions are not parallel-safe unless they say so.
+		* A parallel-safe Action may allocate, for instance by appending attributes, as long as the
+		* memory comes from a thread-safe Allocator. The Entities of a World that allocates from an
+		* arena are therefore never updated in parallel, whatever their Actions say.
+		*
+		* Of the shipped Actions, ActionEvent is parallel-safe when it has a delay, since an event
+		* without one is delivered on the spot, and ActionList and ActionIf are parallel-safe when
+		* every Action they run is.
+		*
+		* @return true if the Action can be updated in parallel, false otherwise
+		*/
+		virtual bool IsParallelSafe() const;
+
 		/**
 		* Returns the name of the Action.
 		*
@@ -5,29 +5,36 @@ namespace Library
 	RTTI_DEFINITIONS(ActionEvent)
 
 	ActionEvent::ActionEvent(const std::string& name)
-		: mName(name)
+		: mName(name), mDelay(0)
 	{
 		InitializeSignatures();
 	}
 
 	void ActionEvent::Update(WorldState& state)
 	{
-		EventMessageAttributed message;
 		assert(state.world);
 		World& world = *state.world;
+
+		// The event goes back to the World's pool once the EventQueue has delivered it, still holding
+		// the parameters of whichever firing used it last
+		Event<EventMessageAttributed>& event = world.EventPool().Acquire();
+		EventMessageAttributed& message = event.Message();
+		message.ClearAuxiliaryAttributes();
 		message.SetWorld(world);
 		message.SetSubtype(mSubtype);
 
-		Event<EventMessageAttributed>* newEvent = new Event<EventMessageAttributed>(message);
-		assert(newEvent);
-
 		// Copy all auxiliary parameters into the event
 		for (std::uint32_t i = AuxiliaryBegin(); i < Size(); ++i)
 		{
-			message.AppendAuxiliaryAttribute(this[i].Name());
+			message.AppendAuxiliaryAttribute(NameAt(i).Name()) = (*this)[i];
 		}
 
-		world.EventQueue().Enqueue(*newEvent, state.GetGameTime(), Milliseconds(mDelay));
+		world.EventQueue().Enqueue(event, state.GetGameTime(), Milliseconds(mDelay));
+	}
+
+	bool ActionEvent::IsParallelSafe() const
+	{
+		return (mDelay > 0);
 	}
 
 	void ActionEvent::InitializeSignatures()
@@ -37,6 +37,16 @@ namespace Library
 		 */
 		virtual void Update(WorldState& state) override;
 
+		/**
+		 * Returns whether the event is delayed. A delayed event is only written into an Event
+		 * taken from the World's pool, which hands each Event out once, and enqueued, and both of
+		 * those are thread-safe. An event without a delay is sent right away, which runs every
+		 * Reaction to it on the updating thread, so the ActionEvent is not parallel-safe.
+		 *
+		 * @return true if the delay is greater than zero, false otherwise
+		 */
+		virtual bool IsParallelSafe() const override;
+
 	private:
 		/**
 		 * Initializes all of the signatures for ActionEvent.
@@ -56,6 +56,22 @@ namespace Library
 		}
 	}
 
+	bool ActionIf::IsParallelSafe() const
+	{
+		return IsBranchParallelSafe(mThen) && IsBranchParallelSafe(mElse);
+	}
+
+	bool ActionIf::IsBranchParallelSafe(const Scope* branch)
+	{
+		if (branch == nullptr)
+		{
+			return true;
+		}
+
+		const Action* action = branch->As<Action>();
+		return (action != nullptr && action->IsParallelSafe());
+	}
+
 	bool ActionIf::WasConditionMet() const
 	{
 		return mConditionMet;
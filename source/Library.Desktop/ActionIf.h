@@ -42,6 +42,14 @@ namespace Library
 		*/
 		virtual void Update(WorldState& state) override;
 
+		/**
+		* Returns whether the then and else Actions are parallel-safe. The ActionIf itself only
+		* reads its condition and records the outcome.
+		*
+		* @return true if the ActionIf can be updated in parallel, false otherwise
+		*/
+		virtual bool IsParallelSafe() const override;
+
 		/**
 		* Return whether or not the condition was met.
 		* 
@@ -54,6 +62,8 @@ namespace Library
 		Scope* mElse;			/**< The Scope that holds the else Actions */
 
 	private:
+		static bool IsBranchParallelSafe(const Scope* branch);
+
 		bool mConditionMet;		/**< Holds a flag to determie if the condition was met */
 	};
 
@@ -23,8 +23,23 @@ namespace Library
 		}
 	}
 
+	bool ActionList::IsParallelSafe() const
+	{
+		for (std::uint32_t i = 0; i < mActions.Size(); ++i)
+		{
+			const Action* action = mActions.Get<Scope*>(i)->As<Action>();
+			if (action == nullptr || !action->IsParallelSafe())
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+
 	Action& ActionList::CreateAction(const std::string& className, const std::string& instanceName)
 	{
+		AllocatorGuard guard(GetAllocator());
 		Action* action = Factory<Action>::Create(className);
 		assert(action != nullptr);
 		action->SetName(instanceName);
@@ -30,6 +30,13 @@ namespace Library
 		 */
 		virtual void Update(WorldState& state) override;
 
+		/**
+		 * Returns whether every Action in the ActionList is parallel-safe.
+		 *
+		 * @return true if the ActionList can be updated in parallel, false otherwise
+		 */
+		virtual bool IsParallelSafe() const override;
+
 		/**
 		 * Creates an Action in the ActionList.
 		 *
@@ -0,0 +1,129 @@
+#include "pch.h"
+
+namespace Library
+{
+#if defined(DEBUG) | defined(_DEBUG)
+	Allocator::Allocator() :
+		mBytesInUse(0), mPeakBytesInUse(0), mAllocationCount(0)
+	{
+	}
+#else
+	Allocator::Allocator()
+	{
+	}
+#endif
+
+	void* Allocator::Allocate(const std::size_t size)
+	{
+		if (size == 0)
+		{
+			return nullptr;
+		}
+
+		void* memory = DoAllocate(size);
+#if defined(DEBUG) | defined(_DEBUG)
+		AddBytesInUse(size);
+		++mAllocationCount;
+#endif
+		return memory;
+	}
+
+	void* Allocator::Reallocate(void* memory, const std::size_t oldSize, const std::size_t newSize)
+	{
+		if (memory == nullptr)
+		{
+			return Allocate(newSize);
+		}
+
+		if (newSize == 0)
+		{
+			Deallocate(memory, oldSize);
+			return nullptr;
+		}
+
+		void* newMemory = DoReallocate(memory, oldSize, newSize);
+#if defined(DEBUG) | defined(_DEBUG)
+		mBytesInUse -= oldSize;
+		AddBytesInUse(newSize);
+#endif
+		return newMemory;
+	}
+
+	void Allocator::Deallocate(void* memory, const std::size_t size)
+	{
+		if (memory != nullptr)
+		{
+			DoDeallocate(memory, size);
+#if defined(DEBUG) | defined(_DEBUG)
+			mBytesInUse -= size;
+#endif
+		}
+	}
+
+#if defined(DEBUG) | defined(_DEBUG)
+	std::size_t Allocator::BytesInUse() const
+	{
+		return mBytesInUse;
+	}
+
+	std::size_t Allocator::PeakBytesInUse() const
+	{
+		return mPeakBytesInUse;
+	}
+
+	std::size_t Allocator::AllocationCount() const
+	{
+		return mAllocationCount;
+	}
+#else
+	std::size_t Allocator::BytesInUse() const
+	{
+		return 0;
+	}
+
+	std::size_t Allocator::PeakBytesInUse() const
+	{
+		return 0;
+	}
+
+	std::size_t Allocator::AllocationCount() const
+	{
+		return 0;
+	}
+#endif
+
+	Allocator& Allocator::Default()
+	{
+		// Constructed on first use so that containers can safely be created during static initialization
+		static SystemAllocator allocator;
+		return allocator;
+	}
+
+	void* Allocator::DoReallocate(void* memory, const std::size_t oldSize, const std::size_t newSize)
+	{
+		void* newMemory = DoAllocate(newSize);
+		std::memcpy(newMemory, memory, (oldSize < newSize ? oldSize : newSize));
+		DoDeallocate(memory, oldSize);
+		return newMemory;
+	}
+
+	void Allocator::ResetBytesInUse()
+	{
+#if defined(DEBUG) | defined(_DEBUG)
+		mBytesInUse = 0;
+#endif
+	}
+
+#if defined(DEBUG) | defined(_DEBUG)
+	void Allocator::AddBytesInUse(const std::size_t size)
+	{
+		const std::size_t bytesInUse = (mBytesInUse += size);
+
+		// Another thread may raise the peak at the same time, so only ever move it upwards
+		std::size_t peak = mPeakBytesInUse;
+		while (bytesInUse > peak && !mPeakBytesInUse.compare_exchange_weak(peak, bytesInUse))
+		{
+		}
+	}
+#endif
+}
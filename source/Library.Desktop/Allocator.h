@@ -0,0 +1,139 @@
+#pragma once
+
+#include <cstddef>
+#include <atomic>
+
+namespace Library
+{
+	/**
+	 * @brief The interface the library's containers get their memory from.
+	 *
+	 * Vector, SList, HashMap, Stack and Datum take an Allocator when they are constructed and
+	 * route every allocation through it, so the caller decides whether memory comes from the
+	 * heap (SystemAllocator), a per-frame or per-level arena (LinearAllocator) or a set of
+	 * fixed-size chunks (PoolAllocator). A container holds on to its Allocator for its whole
+	 * life, so the Allocator must outlive it.
+	 *
+	 * In debug builds every Allocator counts the bytes it has handed out, so giving a subsystem
+	 * its own Allocator is enough to see how much memory that subsystem uses. Release builds
+	 * leave the counting out: every thread allocates through the same default Allocator, and
+	 * updating its shared counters on each allocation would make them contend.
+	 *
+	 * Containers follow the same rules for which Allocator their storage belongs to: a copy is
+	 * made with the default Allocator, a move takes the Allocator along with the storage, and
+	 * a copy assignment keeps the Allocator the container already had.
+	 */
+	class Allocator
+	{
+	public:
+		/**
+		 * Default constructor.
+		 */
+		Allocator();
+
+		// Outstanding memory belongs to the Allocator that handed it out, so Allocators cannot be copied
+		Allocator(const Allocator& rhs) = delete;
+		Allocator& operator=(const Allocator& rhs) = delete;
+
+		/**
+		 * Default deconstructor.
+		 */
+		virtual ~Allocator() = default;
+
+		/**
+		 * Returns a block of uninitialized memory, aligned for any type.
+		 *
+		 * @param size the size of the block, in bytes
+		 * @return the address of the block, or nullptr when the size is zero
+		 */
+		void* Allocate(const std::size_t size);
+
+		/**
+		 * Resizes a block, moving its contents bitwise when it cannot grow in place.
+		 *
+		 * @param memory a block handed out by this Allocator, or nullptr
+		 * @param oldSize the size the block was allocated with
+		 * @param newSize the size the block should have
+		 * @return the address of the resized block
+		 */
+		void* Reallocate(void* memory, const std::size_t oldSize, const std::size_t newSize);
+
+		/**
+		 * Returns a block to the Allocator.
+		 *
+		 * @param memory a block handed out by this Allocator, or nullptr
+		 * @param size the size the block was allocated with
+		 */
+		void Deallocate(void* memory, const std::size_t size);
+
+		/**
+		 * Returns the number of bytes that have been handed out and not yet returned.
+		 *
+		 * @return the number of bytes in use, or zero in a release build
+		 */
+		std::size_t BytesInUse() const;
+
+		/**
+		 * Returns the largest number of bytes that have been in use at once.
+		 *
+		 * @return the peak number of bytes in use, or zero in a release build
+		 */
+		std::size_t PeakBytesInUse() const;
+
+		/**
+		 * Returns the number of blocks that have been handed out over the Allocator's life.
+		 *
+		 * @return the number of allocations, or zero in a release build
+		 */
+		std::size_t AllocationCount() const;
+
+		/**
+		 * Returns the Allocator containers use when none is given, which takes its memory from the heap.
+		 *
+		 * @return a reference to the default Allocator
+		 */
+		static Allocator& Default();
+
+	protected:
+		/**
+		 * Returns a block of uninitialized memory. Called with a size greater than zero.
+		 *
+		 * @param size the size of the block, in bytes
+		 * @return the address of the block
+		 */
+		virtual void* DoAllocate(const std::size_t size) = 0;
+
+		/**
+		 * Resizes a block. By default a new block is allocated, the contents are copied over
+		 * and the old block is returned. Called with a non-null block and a size greater than zero.
+		 *
+		 * @param memory the block to resize
+		 * @param oldSize the size the block was allocated with
+		 * @param newSize the size the block should have
+		 * @return the address of the resized block
+		 */
+		virtual void* DoReallocate(void* memory, const std::size_t oldSize, const std::size_t newSize);
+
+		/**
+		 * Returns a block to the Allocator. Called with a non-null block.
+		 *
+		 * @param memory the block to return
+		 * @param size the size the block was allocated with
+		 */
+		virtual void DoDeallocate(void* memory, const std::size_t size) = 0;
+
+		/**
+		 * Forgets every outstanding block, for Allocators that can release all of their memory at once.
+		 */
+		void ResetBytesInUse();
+
+#if defined(DEBUG) | defined(_DEBUG)
+	private:
+		void AddBytesInUse(const std::size_t size);
+
+		std::atomic<std::size_t> mBytesInUse;			/**< Bytes handed out and not yet returned */
+		std::atomic<std::size_t> mPeakBytesInUse;		/**< The largest value mBytesInUse has reached */
+		std::atomic<std::size_t> mAllocationCount;		/**< The number of blocks handed out */
+#endif
+	};
+}
@@ -83,7 +83,7 @@ namespace Library
 
 	// Copy constructor
 	Attributed::Signature::Signature(const Signature& rhs)
-		: mName(rhs.mName), mInitialValue(rhs.mInitialValue), mSize(rhs.mSize), mStorage(rhs.mStorage)
+		: mName(rhs.mName), mType(rhs.mType), mInitialValue(rhs.mInitialValue), mSize(rhs.mSize), mStorage(rhs.mStorage)
 	{
 	}
 
@@ -91,9 +91,8 @@ namespace Library
 	{
 		if (this != &rhs)
 		{
-			this->~Signature();
-
 			mName = rhs.mName;
+			mType = rhs.mType;
 			mInitialValue = rhs.mInitialValue;
 			mSize = rhs.mSize;
 			mStorage = rhs.mStorage;
@@ -116,21 +115,69 @@ namespace Library
 #pragma region Attributed
 
 	Attributed::Attributed()
-		: mSignatures(), Scope()
+		: mSignatures(), Scope(), mAuxiliaryBegin(1), mComponentStore(nullptr), mComponentRow(0)
 	{
 	}
 
 	Attributed::Attributed(const Attributed& rhs)
-		: mSignatures(rhs.mSignatures), Scope(rhs)
+		: mSignatures(rhs.mSignatures), Scope(rhs), mAuxiliaryBegin(rhs.mAuxiliaryBegin), mComponentStore(nullptr), mComponentRow(0)
 	{
 	}
 
+	Attributed::Attributed(Attributed&& rhs)
+		: Scope(std::move(rhs)), mSignatures(std::move(rhs.mSignatures)), mAuxiliaryBegin(rhs.mAuxiliaryBegin), mComponentStore(rhs.mComponentStore), mComponentRow(rhs.mComponentRow)
+	{
+		Append("this").Set(*static_cast<RTTI*>(this));
+
+		// The Datums came along with the Scope, so only the row's owner changes
+		if (mComponentStore != nullptr)
+		{
+			mComponentStore->Replace(rhs, *this);
+			rhs.mComponentStore = nullptr;
+			rhs.mComponentRow = 0;
+		}
+	}
+
 	Attributed& Attributed::operator=(const Attributed& rhs)
 	{
 		if (this != &rhs)
 		{
+			// Clearing the Scope destroys the Datums the store points at
+			if (mComponentStore != nullptr)
+			{
+				mComponentStore->Release(*this);
+			}
+
 			Scope::operator=(rhs);
 			mSignatures = rhs.mSignatures;
+			mAuxiliaryBegin = rhs.mAuxiliaryBegin;
+		}
+
+		return *this;
+	}
+
+	Attributed& Attributed::operator=(Attributed&& rhs)
+	{
+		if (this != &rhs)
+		{
+			if (mComponentStore != nullptr)
+			{
+				mComponentStore->Release(*this);
+			}
+
+			Scope::operator=(std::move(rhs));
+			mSignatures = std::move(rhs.mSignatures);
+			mAuxiliaryBegin = rhs.mAuxiliaryBegin;
+			Append("this").Set(*static_cast<RTTI*>(this));
+
+			mComponentStore = rhs.mComponentStore;
+			mComponentRow = rhs.mComponentRow;
+			if (mComponentStore != nullptr)
+			{
+				mComponentStore->Replace(rhs, *this);
+				rhs.mComponentStore = nullptr;
+				rhs.mComponentRow = 0;
+			}
 		}
 
 		return *this;
@@ -138,6 +185,12 @@ namespace Library
 
 	Attributed::~Attributed()
 	{
+		// The derived members are already gone, so the packed values are dropped rather than copied back
+		if (mComponentStore != nullptr)
+		{
+			mComponentStore->Release(*this);
+		}
+
 		/*for (std::uint32_t i = 0; i < mSignatures.Size(); ++i)
 		{
 			
@@ -282,7 +335,15 @@ namespace Library
 					}
 					break;
 				case Datum::DatumType::Table:
-					for (std::uint32_t index = 0; index < mSignatures[i].mSize; ++index)
+					// Tables made by CreateTableDatum only hold the children adopted later on
+					datum.SetType(Datum::DatumType::Table);
+					if (mSignatures[i].mInitialValue == nullptr || mSignatures[i].mInitialValue->t == nullptr)
+					{
+						break;
+					}
+
+					// Populate runs once per class in a hierarchy, so only the missing scopes are appended
+					for (std::uint32_t index = datum.Size(); index < mSignatures[i].mSize; ++index)
 					{
 						if (mSignatures[i].mStorage == nullptr)
 						{
@@ -348,6 +409,9 @@ namespace Library
 					break;
 			}
 		}
+
+		// A name prescribed again by a derived class is only appended once, so the signatures can outnumber the entries
+		mAuxiliaryBegin = Size();
 	}
 
 	bool Attributed::IsPrescribedAttribute(const std::string& name) const
@@ -357,9 +421,15 @@ namespace Library
 			return true;
 		}
 
-		for (std::uint32_t i = 0; i < AuxiliaryBegin() - 1; ++i)
+		const Symbol symbol = Symbol::Find(name);
+		if (symbol.IsEmpty())
+		{
+			return false;
+		}
+
+		for (std::uint32_t i = 0; i < mSignatures.Size(); ++i)
 		{
-			if (mSignatures[i].mName == name)
+			if (mSignatures[i].mName == symbol)
 			{
 				return true;
 			}
@@ -388,6 +458,11 @@ namespace Library
 		return Append(name);
 	}
 
+	void Attributed::ClearAuxiliaryAttributes()
+	{
+		Truncate(AuxiliaryBegin());
+	}
+
 #pragma region AddInternalSignature
 
 	void Attributed::AddInternalSignature(const std::string& name, std::int32_t* initialValue, const std::uint32_t size)
@@ -489,14 +564,20 @@ namespace Library
 
 	std::uint32_t Attributed::AuxiliaryBegin() const
 	{
-		return (mSignatures.Size() + 1);
+		return mAuxiliaryBegin;
 	}
 
 	Attributed::Signature* Attributed::GetSignature(const std::string& name) const
 	{
+		const Symbol symbol = Symbol::Find(name);
+		if (symbol.IsEmpty())
+		{
+			return nullptr;
+		}
+
 		for (std::uint32_t i = 0; i < mSignatures.Size(); ++i)
 		{
-			if (mSignatures[i].mName == name)
+			if (mSignatures[i].mName == symbol)
 			{
 				return const_cast<Signature*>(&mSignatures[i]);
 			}
@@ -516,6 +597,80 @@ namespace Library
 		return *datum;
 	}
 
+	Datum& Attributed::FindCached(const Symbol& name, CachedAttribute& cache) const
+	{
+		if (cache.mDatum == nullptr || cache.mRevision != Revision())
+		{
+			cache.mDatum = Find(name);
+			cache.mRevision = Revision();
+		}
+
+		assert(cache.mDatum != nullptr);
+		return *cache.mDatum;
+	}
+
+	void Attributed::MoveExternalStorage(const Attributed& rhs, const std::size_t size)
+	{
+		const std::uintptr_t begin = reinterpret_cast<std::uintptr_t>(&rhs);
+		const std::uintptr_t end = begin + size;
+		const std::uintptr_t destination = reinterpret_cast<std::uintptr_t>(this);
+
+		for (auto& signature : mSignatures)
+		{
+			if (signature.mStorage == nullptr)
+			{
+				continue;
+			}
+
+			const std::uintptr_t address = reinterpret_cast<std::uintptr_t>(signature.mStorage->vp);
+			if (address < begin || address >= end)
+			{
+				continue;
+			}
+
+			// The member sits at the same offset in this object as it did in the moved-from one. Copies of the
+			// moved-from object share its StorageType, so this signature gets its own rather than re-pointing theirs.
+			signature.mStorage = new Signature::StorageType();
+			signature.mStorage->vp = reinterpret_cast<void**>(destination + (address - begin));
+
+			// Packed attributes keep pointing at their row; the member is only written back on Detach
+			if (mComponentStore != nullptr && mComponentStore->IsPacked(signature.mName))
+			{
+				continue;
+			}
+
+			Datum* datum = Find(signature.mName);
+			if (datum == nullptr || !datum->IsExternal())
+			{
+				continue;
+			}
+
+			switch (datum->Type())
+			{
+				case Datum::DatumType::Integer:
+					datum->SetStorage(signature.mStorage->i, signature.mSize);
+					break;
+				case Datum::DatumType::Float:
+					datum->SetStorage(signature.mStorage->f, signature.mSize);
+					break;
+				case Datum::DatumType::Vector:
+					datum->SetStorage(signature.mStorage->v, signature.mSize);
+					break;
+				case Datum::DatumType::Matrix:
+					datum->SetStorage(signature.mStorage->m, signature.mSize);
+					break;
+				case Datum::DatumType::String:
+					datum->SetStorage(signature.mStorage->s, signature.mSize);
+					break;
+				case Datum::DatumType::Pointer:
+					datum->SetStorage(signature.mStorage->p, signature.mSize);
+					break;
+				default:
+					break;
+			}
+		}
+	}
+
 #pragma endregion
 
 }
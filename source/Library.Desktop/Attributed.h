@@ -16,6 +16,8 @@ namespace Library
 	class Attributed : public Scope
 	{
 		RTTI_DECLARATIONS(Attributed, Scope)
+		friend class ComponentStore;
+
 	protected:
 		/** 
 		 * Internal class that represents prescribed attributes.
@@ -98,7 +100,7 @@ namespace Library
 			 */
 			~Signature();
 
-			std::string mName;				/**< A string indicating key to use for Datum in its Scope */
+			Symbol mName;					/**< The interned key to use for Datum in its Scope */
 			Datum::DatumType mType;			/**< The type of Datum enumeration */
 			StorageType* mInitialValue;		/**< The default value */
 			std::uint32_t mSize;			/**< The number of elements in this Datum */
@@ -118,7 +120,8 @@ namespace Library
 		Attributed(const Attributed& rhs);
 
 		/**
-		 * Move constructor.
+		 * Move constructor. Derived classes that bind members as external storage must call
+		 * MoveExternalStorage once their own members have been moved.
 		 *
 		 * @param rhs the other Attributed class to move from
 		 */
@@ -132,14 +135,16 @@ namespace Library
 		Attributed& operator=(const Attributed& rhs);
 
 		/**
-		 * Assignment operator to move data between two Attributed classes.
+		 * Assignment operator to move data between two Attributed classes. Derived classes that
+		 * bind members as external storage must call MoveExternalStorage once their own members
+		 * have been moved.
 		 *
 		 * @param rhs the Attributed class to move data from
 		 */
 		Attributed& operator=(Attributed&& rhs);
 
 		/**
-		 * Default virtual destructor.
+		 * Destructor. Leaves the ComponentStore the object is attached to, if any.
 		 */
 		virtual ~Attributed();
 
@@ -182,6 +187,11 @@ namespace Library
 		 */
 		Datum& AppendAuxiliaryAttribute(const std::string& name);
 
+		/**
+		 * Removes every auxiliary attribute, leaving the prescribed attributes as they are.
+		 */
+		void ClearAuxiliaryAttributes();
+
 		/**
 		 * Adds an internal signature to the Attributed class.
 		 *
@@ -227,8 +237,47 @@ namespace Library
 		 */
 		Datum& CreateTableDatum(const std::string& name);
 
+	protected:
+		/**
+		 * The resolved address of a prescribed attribute, kept so that per-frame code can reach
+		 * the attribute without a hash lookup.
+		 */
+		struct CachedAttribute
+		{
+			CachedAttribute() = default;
+
+			// A cache refers to the Datum of one particular Scope, so copies start out empty
+			CachedAttribute(const CachedAttribute&) {}
+			CachedAttribute& operator=(const CachedAttribute&) { mDatum = nullptr; return *this; }
+
+			Datum* mDatum = nullptr;		/**< The resolved Datum, or nullptr before the first lookup */
+			std::uint32_t mRevision = 0;	/**< The Scope revision the Datum was resolved at */
+		};
+
+		/**
+		 * Returns the Datum for a prescribed attribute through a cache. The attribute is only
+		 * looked up when the cache is empty or the Scope has been cleared since it was filled.
+		 *
+		 * @param name the name of the prescribed attribute
+		 * @param cache the cache for the attribute
+		 * @return a reference to the Datum
+		 */
+		Datum& FindCached(const Symbol& name, CachedAttribute& cache) const;
+
+		/**
+		 * Points the external attributes that were bound to members of a moved-from object at the
+		 * same members of this object. Storage outside of the moved-from object is left alone.
+		 *
+		 * @param rhs the object that was moved from
+		 * @param size the size of the most derived class, which bounds the members to rebind
+		 */
+		void MoveExternalStorage(const Attributed& rhs, const std::size_t size);
+
 	private:
 		Signature* GetSignature(const std::string& name) const;
 		Vector<Signature> mSignatures;
+		std::uint32_t mAuxiliaryBegin;			/**< The number of entries Populate has prescribed so far */
+		ComponentStore* mComponentStore;		/**< The store packing this object's attributes, if any */
+		std::uint32_t mComponentRow;			/**< The row of this object in mComponentStore */
 	};
 }
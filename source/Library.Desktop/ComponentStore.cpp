@@ -0,0 +1,269 @@
+#include "pch.h"
+
+namespace Library
+{
+	ComponentStore::ComponentStore(Allocator& allocator) :
+		mAllocator(&allocator), mColumns(), mOwners(), mCapacity(0)
+	{
+	}
+
+	ComponentStore::~ComponentStore()
+	{
+		// Detaching from the back never moves a row
+		while (!mOwners.IsEmpty())
+		{
+			Detach(*mOwners.Back());
+		}
+
+		for (ColumnData* column : mColumns)
+		{
+			mAllocator->Deallocate(column->mValues, column->mRowSize * mCapacity);
+			delete column;
+		}
+	}
+
+	void ComponentStore::AddColumn(const std::string& name, const Datum::DatumType type, const std::uint32_t size)
+	{
+		if (!mOwners.IsEmpty())
+		{
+			throw std::exception("Columns cannot be added once objects are attached.");
+		}
+
+		if (ElementSize(type) == 0)
+		{
+			throw std::exception("Only integers, floats, vectors, matrices and pointers can be packed.");
+		}
+
+		if (size == 0)
+		{
+			throw std::exception("A column must hold at least one element per row.");
+		}
+
+		const Symbol symbol(name);
+		if (IsPacked(symbol))
+		{
+			throw std::exception("The column already exists.");
+		}
+
+		ColumnData* column = new ColumnData{ symbol, type, size, ElementSize(type) * size, nullptr, Vector<Datum*>() };
+		column->mValues = static_cast<char*>(mAllocator->Allocate(column->mRowSize * mCapacity));
+		mColumns.PushBack(column);
+	}
+
+	std::uint32_t ComponentStore::Attach(Attributed& attributed)
+	{
+		if (attributed.mComponentStore != nullptr)
+		{
+			throw std::exception("The object is already attached to a ComponentStore.");
+		}
+
+		// Check every column before touching anything, so a failed Attach leaves the object as it was
+		for (ColumnData* column : mColumns)
+		{
+			Attributed::Signature* signature = attributed.GetSignature(column->mName.Name());
+			Datum* datum = attributed.Find(column->mName);
+			if (signature == nullptr || signature->mStorage == nullptr || datum == nullptr || !datum->IsExternal())
+			{
+				throw std::exception("The object does not have an external attribute for every column.");
+			}
+
+			if (datum->Type() != column->mType || datum->Size() != column->mSize)
+			{
+				throw std::exception("The attribute does not match the type and size of its column.");
+			}
+		}
+
+		const std::uint32_t row = mOwners.Size();
+		if (row == mCapacity)
+		{
+			Reserve(mCapacity == 0 ? DefaultCapacity : mCapacity * 2);
+		}
+
+		for (ColumnData* column : mColumns)
+		{
+			void* home = attributed.GetSignature(column->mName.Name())->mStorage->vp;
+			char* storage = column->mValues + column->mRowSize * row;
+			std::memcpy(storage, home, column->mRowSize);
+
+			Datum& datum = *attributed.Find(column->mName);
+			Bind(datum, column->mType, storage, column->mSize);
+			column->mBindings.PushBack(&datum);
+		}
+
+		mOwners.PushBack(&attributed);
+		attributed.mComponentStore = this;
+		attributed.mComponentRow = row;
+
+		return row;
+	}
+
+	void ComponentStore::Detach(Attributed& attributed)
+	{
+		if (attributed.mComponentStore != this)
+		{
+			throw std::exception("The object is not attached to this ComponentStore.");
+		}
+
+		const std::uint32_t row = attributed.mComponentRow;
+		for (ColumnData* column : mColumns)
+		{
+			void* home = attributed.GetSignature(column->mName.Name())->mStorage->vp;
+			std::memcpy(home, column->mValues + column->mRowSize * row, column->mRowSize);
+			Bind(*column->mBindings[row], column->mType, home, column->mSize);
+		}
+
+		RemoveRow(row);
+	}
+
+	bool ComponentStore::IsAttached(const Attributed& attributed) const
+	{
+		return (attributed.mComponentStore == this);
+	}
+
+	Attributed& ComponentStore::Owner(const std::uint32_t row) const
+	{
+		if (row >= mOwners.Size())
+		{
+			throw std::exception("Row out of bounds.");
+		}
+
+		return *mOwners[row];
+	}
+
+	std::uint32_t ComponentStore::Size() const
+	{
+		return mOwners.Size();
+	}
+
+	std::uint32_t ComponentStore::ColumnCount() const
+	{
+		return mColumns.Size();
+	}
+
+	ComponentStore::ColumnData& ComponentStore::FindColumn(const Symbol& name) const
+	{
+		for (ColumnData* column : mColumns)
+		{
+			if (column->mName == name)
+			{
+				return *column;
+			}
+		}
+
+		throw std::exception("The column does not exist.");
+	}
+
+	bool ComponentStore::IsPacked(const Symbol& name) const
+	{
+		for (ColumnData* column : mColumns)
+		{
+			if (column->mName == name)
+			{
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	void ComponentStore::Reserve(const std::uint32_t capacity)
+	{
+		for (ColumnData* column : mColumns)
+		{
+			char* values = static_cast<char*>(mAllocator->Reallocate(column->mValues, column->mRowSize * mCapacity, column->mRowSize * capacity));
+			if (values != column->mValues)
+			{
+				// The column moved, so every Datum pointing into it has to follow
+				column->mValues = values;
+				for (std::uint32_t row = 0; row < column->mBindings.Size(); ++row)
+				{
+					Bind(*column->mBindings[row], column->mType, values + column->mRowSize * row, column->mSize);
+				}
+			}
+		}
+
+		mCapacity = capacity;
+	}
+
+	void ComponentStore::RemoveRow(const std::uint32_t row)
+	{
+		Attributed* removed = mOwners[row];
+		const std::uint32_t lastRow = mOwners.Size() - 1;
+		if (row != lastRow)
+		{
+			for (ColumnData* column : mColumns)
+			{
+				char* storage = column->mValues + column->mRowSize * row;
+				std::memcpy(storage, column->mValues + column->mRowSize * lastRow, column->mRowSize);
+				column->mBindings[row] = column->mBindings[lastRow];
+				Bind(*column->mBindings[row], column->mType, storage, column->mSize);
+			}
+
+			mOwners[row] = mOwners[lastRow];
+			mOwners[row]->mComponentRow = row;
+		}
+
+		for (ColumnData* column : mColumns)
+		{
+			column->mBindings.PopBack();
+		}
+		mOwners.PopBack();
+
+		removed->mComponentStore = nullptr;
+		removed->mComponentRow = 0;
+	}
+
+	void ComponentStore::Replace(const Attributed& rhs, Attributed& attributed)
+	{
+		mOwners[rhs.mComponentRow] = &attributed;
+	}
+
+	void ComponentStore::Release(Attributed& attributed)
+	{
+		// The members are gone or about to be overwritten, so nothing is copied back
+		RemoveRow(attributed.mComponentRow);
+	}
+
+	std::size_t ComponentStore::ElementSize(const Datum::DatumType type)
+	{
+		switch (type)
+		{
+			case Datum::DatumType::Integer:
+				return sizeof(std::int32_t);
+			case Datum::DatumType::Float:
+				return sizeof(float);
+			case Datum::DatumType::Vector:
+				return sizeof(glm::vec4);
+			case Datum::DatumType::Matrix:
+				return sizeof(glm::mat4);
+			case Datum::DatumType::Pointer:
+				return sizeof(RTTI*);
+			default:
+				return 0;
+		}
+	}
+
+	void ComponentStore::Bind(Datum& datum, const Datum::DatumType type, void* storage, const std::uint32_t size)
+	{
+		switch (type)
+		{
+			case Datum::DatumType::Integer:
+				datum.SetStorage(static_cast<std::int32_t*>(storage), size);
+				break;
+			case Datum::DatumType::Float:
+				datum.SetStorage(static_cast<float*>(storage), size);
+				break;
+			case Datum::DatumType::Vector:
+				datum.SetStorage(static_cast<glm::vec4*>(storage), size);
+				break;
+			case Datum::DatumType::Matrix:
+				datum.SetStorage(static_cast<glm::mat4*>(storage), size);
+				break;
+			case Datum::DatumType::Pointer:
+				datum.SetStorage(static_cast<RTTI**>(storage), size);
+				break;
+			default:
+				break;
+		}
+	}
+}
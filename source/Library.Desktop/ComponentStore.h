@@ -0,0 +1,145 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include "Allocator.h"
+#include "Vector.h"
+#include "Symbol.h"
+#include "Span.h"
+#include "Datum.h"
+
+namespace Library
+{
+	class Attributed;
+
+	/**
+	 * @brief Packs prescribed attributes of many Attributed objects into structure-of-arrays columns.
+	 *
+	 * Each column holds one external attribute, such as "position", for every attached object,
+	 * one row per object, so systems can walk all positions with a linear loop over a Span.
+	 * Attaching an object copies the values of its attributes into a new row and points the
+	 * object's Datums at that row with Datum::SetStorage, so the Scope API keeps working; while
+	 * attached, the Datum is the source of truth rather than the member it was declared on.
+	 * Detaching copies the values back into the members. Rows are swap-removed, and every Datum
+	 * is re-pointed when its row moves or a column grows.
+	 *
+	 * Only fixed-size value types can be packed: integers, floats, vectors, matrices and pointers.
+	 * Objects that are destroyed while attached leave the store on their own. A ComponentStore
+	 * is not thread-safe.
+	 */
+	class ComponentStore final
+	{
+		friend class Attributed;
+
+	public:
+		/**
+		 * Constructs an empty ComponentStore.
+		 *
+		 * @param allocator the Allocator the columns come from
+		 */
+		explicit ComponentStore(Allocator& allocator = Allocator::Default());
+
+		// Attached objects refer back to the store they are packed into, so it cannot be copied
+		ComponentStore(const ComponentStore& rhs) = delete;
+		ComponentStore& operator=(const ComponentStore& rhs) = delete;
+
+		/**
+		 * Destructor. Detaches every object, copying its values back into its members.
+		 */
+		~ComponentStore();
+
+		/**
+		 * Declares a column. Columns can only be added while the store is empty.
+		 *
+		 * @param name the name of the external attribute to pack
+		 * @param type the type of the attribute
+		 * @param size the number of elements the attribute holds in each object
+		 */
+		void AddColumn(const std::string& name, const Datum::DatumType type, const std::uint32_t size = 1);
+
+		/**
+		 * Packs the attributes of an object into a new row. The object must declare every column
+		 * as an external attribute of the same type and size, and must not be attached elsewhere.
+		 *
+		 * @param attributed the object to attach
+		 * @return the row the object was given
+		 */
+		std::uint32_t Attach(Attributed& attributed);
+
+		/**
+		 * Copies an object's values back into its members and removes its row. The last row is
+		 * moved into the freed one.
+		 *
+		 * @param attributed the object to detach
+		 */
+		void Detach(Attributed& attributed);
+
+		/**
+		 * Returns whether an object is attached to this store.
+		 *
+		 * @param attributed the object to look for
+		 * @return true if the object is attached, false otherwise
+		 */
+		bool IsAttached(const Attributed& attributed) const;
+
+		/**
+		 * Returns the object in a given row.
+		 *
+		 * @param row the row to look up
+		 * @return a reference to the object
+		 */
+		Attributed& Owner(const std::uint32_t row) const;
+
+		/**
+		 * Returns the number of attached objects.
+		 *
+		 * @return the number of rows
+		 */
+		std::uint32_t Size() const;
+
+		/**
+		 * Returns the number of columns.
+		 *
+		 * @return the number of columns
+		 */
+		std::uint32_t ColumnCount() const;
+
+		/**
+		 * Returns a view over every value in a column. Row i holds elements
+		 * [i * size, (i + 1) * size). The view is invalidated by Attach and Detach.
+		 *
+		 * @param name the name of the column
+		 * @return a Span over the column
+		 */
+		template<typename T> Span<T> Column(const std::string& name);
+
+		static const std::uint32_t DefaultCapacity = 16;		/**< The number of rows reserved by the first Attach */
+
+	private:
+		struct ColumnData
+		{
+			Symbol mName;					/**< The name of the packed attribute */
+			Datum::DatumType mType;			/**< The type of the packed attribute */
+			std::uint32_t mSize;			/**< The number of elements in each row */
+			std::size_t mRowSize;			/**< The number of bytes in each row */
+			char* mValues;					/**< The rows, back to back */
+			Vector<Datum*> mBindings;		/**< The Datum pointed at each row */
+		};
+
+		ColumnData& FindColumn(const Symbol& name) const;
+		bool IsPacked(const Symbol& name) const;
+		void Reserve(const std::uint32_t capacity);
+		void RemoveRow(const std::uint32_t row);
+		void Replace(const Attributed& rhs, Attributed& attributed);
+		void Release(Attributed& attributed);
+		static std::size_t ElementSize(const Datum::DatumType type);
+		static void Bind(Datum& datum, const Datum::DatumType type, void* storage, const std::uint32_t size);
+
+		Allocator* mAllocator;				/**< Where the columns come from */
+		Vector<ColumnData*> mColumns;		/**< The packed attributes */
+		Vector<Attributed*> mOwners;		/**< The object in each row */
+		std::uint32_t mCapacity;			/**< The number of rows each column has room for */
+	};
+}
+
+#include "ComponentStore.inl"
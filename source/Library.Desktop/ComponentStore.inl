@@ -0,0 +1,16 @@
+#include "pch.h"
+
+namespace Library
+{
+	template<typename T>
+	Span<T> ComponentStore::Column(const std::string& name)
+	{
+		const ColumnData& column = FindColumn(Symbol::Find(name));
+		if (column.mType != Datum::TypeOf<T>())
+		{
+			throw std::exception("The column holds a different type.");
+		}
+
+		return Span<T>(reinterpret_cast<T*>(column.mValues), mOwners.Size() * column.mSize);
+	}
+}
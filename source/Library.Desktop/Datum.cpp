@@ -2,25 +2,35 @@
 
 namespace Library
 {
-
 #pragma region Datum
 
 	Datum::Datum() :
-		mData(), mType(DatumType::Unknown), mSize(0), mCapacity(0), mIsExternal(false)
+		mData(), mInline(), mType(DatumType::Unknown), mSize(0), mCapacity(0), mIsExternal(false), mAllocator(&Allocator::Default()), mGrowthStrategy(DefaultGrowthStrategy)
 	{
 	}
 
-	Datum::Datum(const DatumType type, const std::uint32_t capacity) :
-		mData(), mType(type), mSize(0), mCapacity(capacity), mIsExternal(false)
+	Datum::Datum(const DatumType type, const std::uint32_t capacity, Allocator& allocator) :
+		mData(), mInline(), mType(type), mSize(0), mCapacity(0), mIsExternal(false), mAllocator(&allocator), mGrowthStrategy(DefaultGrowthStrategy)
 	{
+		if (mType != DatumType::Unknown)
+		{
+			Reserve(capacity);
+		}
 	}
 
 	Datum::Datum(const Datum& rhs) :
 		Datum()
 	{
+		mGrowthStrategy = rhs.mGrowthStrategy;
 		operator=(rhs);
 	}
 
+	Datum::Datum(Datum&& rhs) :
+		Datum()
+	{
+		operator=(std::move(rhs));
+	}
+
 #pragma region Assignment Operator Overloads
 
 	Datum& Datum::operator=(const Datum& rhs)
@@ -30,64 +40,60 @@ namespace Library
 			Clear();
 
 			mType = rhs.mType;
-			mSize = rhs.mSize;
-			mCapacity = rhs.mCapacity;
 			mIsExternal = rhs.mIsExternal;
 
 			if (mIsExternal)
 			{
 				// The lhs is external
 				mData.i = rhs.mData.i;
+				mSize = rhs.mSize;
+				mCapacity = rhs.mCapacity;
 			}
-			else
+			else if (mType != DatumType::Unknown)
 			{
 				// The lhs is internal
+				Reserve(rhs.mCapacity);
+				mSize = rhs.mSize;
+
 				switch (mType)
 				{
 					case DatumType::Integer:
-						mData.i = new std::int32_t[rhs.mCapacity];
 						for (uint32_t i = 0; i < rhs.mSize; ++i)
 						{
 							mData.i[i] = rhs.mData.i[i];
 						}
 						break;
 					case DatumType::Float:
-						mData.f = new float[rhs.mCapacity];
 						for (uint32_t i = 0; i < rhs.mSize; ++i)
 						{
 							mData.f[i] = rhs.mData.f[i];
 						}
 						break;
 					case DatumType::Vector:
-						mData.v = new glm::vec4[rhs.mCapacity];
 						for (uint32_t i = 0; i < rhs.mSize; ++i)
 						{
 							mData.v[i] = rhs.mData.v[i];
 						}
 						break;
 					case DatumType::Matrix:
-						mData.m = new glm::mat4[rhs.mCapacity];
 						for (uint32_t i = 0; i < rhs.mSize; ++i)
 						{
 							mData.m[i] = rhs.mData.m[i];
 						}
 						break;
 					case DatumType::Table:
-						mData.t = new Scope*[rhs.mCapacity];
 						for (uint32_t i = 0; i < rhs.mSize; ++i)
 						{
 							mData.t[i] = rhs.mData.t[i];
 						}
 						break;
 					case DatumType::String:
-						mData.s = new std::string[rhs.mCapacity];
 						for (uint32_t i = 0; i < rhs.mSize; ++i)
 						{
 							mData.s[i] = rhs.mData.s[i];
 						}
 						break;
 					case DatumType::Pointer:
-						mData.p = new RTTI*[rhs.mCapacity];
 						for (uint32_t i = 0; i < rhs.mSize; ++i)
 						{
 							mData.p[i] = rhs.mData.p[i];
@@ -102,6 +108,40 @@ namespace Library
 		return *this;
 	}
 
+	Datum& Datum::operator=(Datum&& rhs)
+	{
+		if (this != &rhs)
+		{
+			Clear();
+
+			if (rhs.IsInline())
+			{
+				// Inline values live inside the Datum, so they are the one thing that has to be copied
+				std::memcpy(&mInline, &rhs.mInline, sizeof(mInline));
+				mData.i = &mInline.i;
+			}
+			else
+			{
+				mData = rhs.mData;
+			}
+
+			mType = rhs.mType;
+			mSize = rhs.mSize;
+			mCapacity = rhs.mCapacity;
+			mIsExternal = rhs.mIsExternal;
+			mAllocator = rhs.mAllocator;
+			mGrowthStrategy = rhs.mGrowthStrategy;
+
+			rhs.mData.i = nullptr;
+			rhs.mType = DatumType::Unknown;
+			rhs.mSize = 0;
+			rhs.mCapacity = 0;
+			rhs.mIsExternal = false;
+		}
+
+		return *this;
+	}
+
 	Datum& Datum::operator=(const std::int32_t rhs)
 	{
 		if (mType == DatumType::Unknown)
@@ -438,104 +478,132 @@ namespace Library
 		--mSize;
 	}
 
+	void Datum::SwapRemoveTable(const std::uint32_t index)
+	{
+		if (index >= mSize)
+		{
+			throw std::exception("Index out of bounds.");
+		}
+
+		if (mType != DatumType::Table)
+		{
+			throw std::exception("Can only remove tables.");
+		}
+
+		mData.t[index] = mData.t[mSize - 1];
+		mData.t[--mSize] = nullptr;
+	}
+
+	std::uint32_t Datum::DefaultGrowthStrategy(const std::uint32_t capacity)
+	{
+		return (capacity == 0 ? 1 : capacity * 2);
+	}
+
+	void Datum::SetGrowthStrategy(GrowthStrategy strategy)
+	{
+		mGrowthStrategy = (strategy != nullptr ? strategy : DefaultGrowthStrategy);
+	}
+
+	Datum::GrowthStrategy Datum::GetGrowthStrategy() const
+	{
+		return mGrowthStrategy;
+	}
+
+	void Datum::Grow()
+	{
+		if (mIsExternal)
+		{
+			throw std::exception("External Datums cannot be resized.");
+		}
+
+		const std::uint32_t capacity = mGrowthStrategy(mCapacity);
+		Reserve(capacity > mCapacity ? capacity : mCapacity + 1);
+	}
+
+	template<typename T>
+	T* Datum::Reallocate(T* values, const std::uint32_t capacity, const bool wasInline) const
+	{
+		T* newValues = static_cast<T*>(mAllocator->Allocate(sizeof(T) * capacity));
+		for (std::uint32_t i = 0; i < capacity; ++i)
+		{
+			new(newValues + i)T;
+		}
+
+		if (mSize > 0)
+		{
+			MoveValues(newValues, values, mSize);
+		}
+
+		if (!wasInline)
+		{
+			Release(values);
+		}
+
+		return newValues;
+	}
+
+	template<typename T>
+	void Datum::Release(T* values) const
+	{
+		for (std::uint32_t i = 0; i < mCapacity; ++i)
+		{
+			values[i].~T();
+		}
+
+		mAllocator->Deallocate(values, sizeof(T) * mCapacity);
+	}
+
+	template<typename T>
+	void Datum::MoveValues(T* destination, T* source, const std::uint32_t count)
+	{
+		// Every other Datum type is plain old data, so the values can be copied as a block
+		std::memcpy(destination, source, count * sizeof(T));
+	}
+
+	void Datum::MoveValues(std::string* destination, std::string* source, const std::uint32_t count)
+	{
+		for (std::uint32_t i = 0; i < count; ++i)
+		{
+			destination[i] = std::move(source[i]);
+		}
+	}
+
 	void Datum::Reserve(const std::uint32_t capacity)
 	{
 		if (capacity > mCapacity)
 		{
-			DatumValues newDatum;
+			if (mCapacity == 0 && capacity == 1 && SupportsInlineStorage(mType))
+			{
+				// Every member of both unions starts at the same address, so one pointer serves all types
+				mData.i = &mInline.i;
+				mCapacity = capacity;
+				return;
+			}
+
+			const bool wasInline = IsInline();
 
 			switch (mType)
 			{
 			case DatumType::Integer:
-				newDatum.i = new std::int32_t[capacity];
-				if (mCapacity > 0)
-				{
-					for (std::uint32_t i = 0; i < mCapacity; ++i)
-					{
-						// Copy the old values into the new container
-						newDatum.i[i] = mData.i[i];
-					}
-					delete[] mData.i;
-				}
-				mData.i = newDatum.i;
+				mData.i = Reallocate(mData.i, capacity, wasInline);
 				break;
 			case DatumType::Float:
-				newDatum.f = new float[capacity];
-				if (mCapacity > 0)
-				{
-					for (std::uint32_t i = 0; i < mCapacity; ++i)
-					{
-						// Copy the old values into the new container
-						newDatum.f[i] = mData.f[i];
-					}
-					delete[] mData.f;
-				}
-				mData.f = newDatum.f;
+				mData.f = Reallocate(mData.f, capacity, wasInline);
 				break;
 			case DatumType::Vector:
-				newDatum.v = new glm::vec4[capacity];
-				if (mCapacity > 0)
-				{
-					for (std::uint32_t i = 0; i < mCapacity; ++i)
-					{
-						// Copy the old values into the new container
-						newDatum.v[i] = mData.v[i];
-					}
-					delete[] mData.v;
-				}
-				mData.v = newDatum.v;
+				mData.v = Reallocate(mData.v, capacity, wasInline);
 				break;
 			case DatumType::Matrix:
-				newDatum.m = new glm::mat4[capacity];
-				if (mCapacity > 0)
-				{
-					for (std::uint32_t i = 0; i < mCapacity; ++i)
-					{
-						// Copy the old values into the new container
-						newDatum.m[i] = mData.m[i];
-					}
-					delete[] mData.m;
-				}
-				mData.m = newDatum.m;
+				mData.m = Reallocate(mData.m, capacity, wasInline);
 				break;
 			case DatumType::Table:
-				newDatum.t = new Scope*[capacity];
-				if (mCapacity > 0)
-				{
-					for (std::uint32_t i = 0; i < mCapacity; ++i)
-					{
-						// Copy the old values into the new container
-						newDatum.t[i] = mData.t[i];
-					}
-					delete[] mData.t;
-				}
-				mData.t = newDatum.t;
+				mData.t = Reallocate(mData.t, capacity, wasInline);
 				break;
 			case DatumType::String:
-				newDatum.s = new std::string[capacity];
-				if (mCapacity > 0)
-				{
-					for (std::uint32_t i = 0; i < mCapacity; ++i)
-					{
-						// Copy the old values into the new container
-						newDatum.s[i] = mData.s[i];
-					}
-					delete[] mData.s;
-				}
-				mData.s = newDatum.s;
+				mData.s = Reallocate(mData.s, capacity, wasInline);
 				break;
 			case DatumType::Pointer:
-				newDatum.p = new RTTI*[capacity];
-				if (mCapacity > 0)
-				{
-					for (std::uint32_t i = 0; i < mCapacity; ++i)
-					{
-						// Copy the old values into the new container
-						newDatum.p[i] = mData.p[i];
-					}
-					delete[] mData.p;
-				}
-				mData.p = newDatum.p;
+				mData.p = Reallocate(mData.p, capacity, wasInline);
 				break;
 			default:
 				throw std::exception("Cannot Reserve an unknown Datum type.");
@@ -549,79 +617,79 @@ namespace Library
 
 	void Datum::PushBack(const std::int32_t value)
 	{
-		if (++mSize > mCapacity)
+		if (mSize == mCapacity)
 		{
 			// Capacity exceeded, we must allocate more memory
-			Reserve(mSize);
+			Grow();
 		}
 
-		mData.i[mSize - 1] = value;
+		mData.i[mSize++] = value;
 	}
 
 	void Datum::PushBack(const float value)
 	{
-		if (++mSize > mCapacity)
+		if (mSize == mCapacity)
 		{
 			// Capacity exceeded, we must allocate more memory
-			Reserve(mSize);
+			Grow();
 		}
 
-		mData.f[mSize - 1] = value;
+		mData.f[mSize++] = value;
 	}
 
 	void Datum::PushBack(const glm::vec4& value)
 	{
-		if (++mSize > mCapacity)
+		if (mSize == mCapacity)
 		{
 			// Capacity exceeded, we must allocate more memory
-			Reserve(mSize);
+			Grow();
 		}
 
-		mData.v[mSize - 1] = value;
+		mData.v[mSize++] = value;
 	}
 
 	void Datum::PushBack(const glm::mat4& value)
 	{
-		if (++mSize > mCapacity)
+		if (mSize == mCapacity)
 		{
 			// Capacity exceeded, we must allocate more memory
-			Reserve(mSize);
+			Grow();
 		}
 
-		mData.m[mSize - 1] = value;
+		mData.m[mSize++] = value;
 	}
 
 	void Datum::PushBack(Scope& value)
 	{
-		if (++mSize > mCapacity)
+		if (mSize == mCapacity)
 		{
 			// Capacity exceeded, we must allocate more memory
-			Reserve(mSize);
+			Grow();
 		}
 
-		mData.t[mSize - 1] = &value;
+		mData.t[mSize++] = &value;
 	}
 
 	void Datum::PushBack(const std::string& value)
 	{
-		if (++mSize > mCapacity)
+		if (mSize == mCapacity)
 		{
 			// Capacity exceeded, we must allocate more memory
-			Reserve(mSize);
+			Grow();
 		}
 
-		mData.s[mSize - 1] = value;
+		mData.s[mSize++] = value;
 	}
 
 	void Datum::PushBack(RTTI& value)
 	{
-		if (++mSize > mCapacity)
+		if (mSize == mCapacity)
 		{
 			// Capacity exceeded, we must allocate more memory
-			Reserve(mSize);
+			Grow();
 		}
 
-		mData.p[mSize - 1] = &value;
+		mData.p[mSize++] = &value;
 	}
 
 #pragma endregion
@@ -655,30 +723,34 @@ namespace Library
 
 	void Datum::Clear()
 	{
-		if (!mIsExternal)
+		if (IsInline())
+		{
+			mData.i = nullptr;
+		}
+		else if (!mIsExternal)
 		{
 			switch (mType)
 			{
 				case DatumType::Integer:
-					delete[] mData.i;
+					Release(mData.i);
 					break;
 				case DatumType::Float:
-					delete[] mData.f;
+					Release(mData.f);
 					break;
 				case DatumType::Vector:
-					delete[] mData.v;
+					Release(mData.v);
 					break;
 				case DatumType::Matrix:
-					delete[] mData.m;
+					Release(mData.m);
 					break;
 				case DatumType::Table:
-					delete[] mData.t;
+					Release(mData.t);
 					break;
 				case DatumType::String:
-					delete[] mData.s;
+					Release(mData.s);
 					break;
 				case DatumType::Pointer:
-					delete[] mData.p;
+					Release(mData.p);
 					break;
 			}
 		}
@@ -1166,6 +1238,26 @@ namespace Library
 		return mIsExternal;
 	}
 
+	bool Datum::IsInline() const
+	{
+		return (!mIsExternal && mCapacity == 1 && mData.i == &mInline.i);
+	}
+
+	bool Datum::SupportsInlineStorage(const DatumType type)
+	{
+		switch (type)
+		{
+			case DatumType::Integer:
+			case DatumType::Float:
+			case DatumType::Vector:
+			case DatumType::Table:
+			case DatumType::Pointer:
+				return true;
+			default:
+				return false;
+		}
+	}
+
 #pragma region Get()
 
 	template<>
@@ -31,6 +31,17 @@ namespace Library
 			DatumValues() : i(nullptr) {}
 		};
 
+		union InlineValue
+		{
+			std::int32_t i;
+			float f;
+			glm::vec4 v;
+			Scope* t;
+			RTTI* p;
+
+			InlineValue() : v() {}
+		};
+
 	public:
 		/**
 		 * @brief The types of data that a Datum supports.
@@ -48,6 +59,14 @@ namespace Library
 			End
 		};
 
+		/**
+		 * @brief Computes the capacity a Datum grows to when an append finds it full.
+		 *
+		 * @param capacity the current capacity
+		 * @return the new capacity
+		 */
+		typedef std::uint32_t(*GrowthStrategy)(const std::uint32_t capacity);
+
 		/**
 		 * Default constructor to initialize a Datum.
 		 */
@@ -58,8 +77,9 @@ namespace Library
 		 *
 		 * @param type the DatumType to assign to the datum
 		 * @param capacity the Datum's initial capacity
+		 * @param allocator the Allocator the Datum's values come from
 		 */
-		Datum(const DatumType type, const std::uint32_t capacity);
+		Datum(const DatumType type, const std::uint32_t capacity, Allocator& allocator = Allocator::Default());
 
 		/**
 		 * Copy constructor to perform a deep-copy of a Datum.
@@ -68,6 +88,21 @@ namespace Library
 		 */
 		Datum(const Datum& rhs);
 
+		/**
+		 * Move constructor. Takes over the storage, Allocator and growth strategy of the given Datum, which is left empty.
+		 *
+		 * @param rhs the Datum to move from
+		 */
+		Datum(Datum&& rhs);
+
+		/**
+		 * Move the contents, Allocator and growth strategy of the given Datum into this one. The given Datum is left empty.
+		 *
+		 * @param rhs the Datum to move from
+		 * @return a reference to this Datum
+		 */
+		Datum& operator=(Datum&& rhs);
+
 		/**
 		 * Deep-copy the contents of the given Datum into this one. Can also copy
 		 * scalar values.
@@ -138,13 +173,47 @@ namespace Library
 		 */
 		void RemoveTable(const std::uint32_t index);
 
+		/**
+		 * Removes a table pointer from the datum in constant time by moving the last table
+		 * pointer into its place. The order of the remaining tables is not preserved.
+		 *
+		 * @param index the index of the table pointer to remove
+		 */
+		void SwapRemoveTable(const std::uint32_t index);
+
 		/**
 		 * Increases the capacity to the new value specified, if it is larger than the previous capacity.
+		 * A single integer, float, vector, table or pointer is stored inside the Datum itself; the
+		 * heap is only used once the Datum grows past one element.
 		 *
 		 * @param capacity the new capacity
 		 */
 		void Datum::Reserve(const std::uint32_t capacity);
 
+		/**
+		 * The default growth strategy, which doubles the capacity so that appending N values
+		 * costs amortized linear time.
+		 *
+		 * @param capacity the current capacity
+		 * @return twice the current capacity, or one for an empty Datum
+		 */
+		static std::uint32_t DefaultGrowthStrategy(const std::uint32_t capacity);
+
+		/**
+		 * Sets the growth strategy this Datum uses when an append finds it full. Copies and moves
+		 * constructed from this Datum start out with the same strategy.
+		 *
+		 * @param strategy the new growth strategy, or nullptr to restore the default
+		 */
+		void SetGrowthStrategy(GrowthStrategy strategy);
+
+		/**
+		 * Returns the growth strategy this Datum uses when an append finds it full.
+		 *
+		 * @return the growth strategy
+		 */
+		GrowthStrategy GetGrowthStrategy() const;
+
 		/**
 		 * Append data to the back of the container
 		 *
@@ -244,6 +313,13 @@ namespace Library
 		 */
 		bool IsExternal() const;
 
+		/**
+		 * Returns a flag specifying if the value is stored inside the Datum rather than on the heap.
+		 *
+		 * @return true if the container is using its inline storage, false otherwise
+		 */
+		bool IsInline() const;
+
 		/**
 		 * Returns a value from the Datum array at a specified index.
 		 *
@@ -259,12 +335,41 @@ namespace Library
 		template<> const std::string& Get<std::string>(const std::uint32_t index) const;
 		template<> RTTI* const & Get<RTTI*>(const std::uint32_t index) const;
 
+		/**
+		 * Returns a typed view over all of the values in the Datum. The type is checked once for
+		 * the whole view, so loops over it do no per-element type or bounds checks. The view is
+		 * invalidated by anything that reallocates the Datum's storage.
+		 *
+		 * @return a Span over the values in the Datum
+		 */
+		template<typename T> Span<T> AsSpan();
+		template<typename T> Span<const T> AsSpan() const;
+
+		/**
+		 * Returns the DatumType that holds values of a given C++ type.
+		 *
+		 * @return the matching DatumType
+		 */
+		template<typename T> static DatumType TypeOf();
+
 	private:
+		static bool SupportsInlineStorage(const DatumType type);
+		void Grow();
+		template<typename T> T* Reallocate(T* values, const std::uint32_t capacity, const bool wasInline) const;
+		template<typename T> void Release(T* values) const;
+		template<typename T> static void MoveValues(T* destination, T* source, const std::uint32_t count);
+		static void MoveValues(std::string* destination, std::string* source, const std::uint32_t count);
+
 		DatumValues mData;
+		InlineValue mInline;		/**< Storage for a single scalar, used instead of the heap while the capacity is one */
 		DatumType mType;
 		std::uint32_t mSize;
 		std::uint32_t mCapacity;
 		bool mIsExternal;
+		Allocator* mAllocator;		/**< Where the values come from when they do not fit inline */
+		GrowthStrategy mGrowthStrategy;		/**< Computes the capacity to grow to when an append finds the Datum full */
 	};
 
 }
+
+#include "Datum.inl"
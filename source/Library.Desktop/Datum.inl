@@ -0,0 +1,77 @@
+#include "pch.h"
+
+namespace Library
+{
+#pragma region TypeOf()
+
+	template<>
+	inline Datum::DatumType Datum::TypeOf<std::int32_t>()
+	{
+		return DatumType::Integer;
+	}
+
+	template<>
+	inline Datum::DatumType Datum::TypeOf<float>()
+	{
+		return DatumType::Float;
+	}
+
+	template<>
+	inline Datum::DatumType Datum::TypeOf<glm::vec4>()
+	{
+		return DatumType::Vector;
+	}
+
+	template<>
+	inline Datum::DatumType Datum::TypeOf<glm::mat4>()
+	{
+		return DatumType::Matrix;
+	}
+
+	template<>
+	inline Datum::DatumType Datum::TypeOf<Scope*>()
+	{
+		return DatumType::Table;
+	}
+
+	template<>
+	inline Datum::DatumType Datum::TypeOf<std::string>()
+	{
+		return DatumType::String;
+	}
+
+	template<>
+	inline Datum::DatumType Datum::TypeOf<RTTI*>()
+	{
+		return DatumType::Pointer;
+	}
+
+#pragma endregion
+
+#pragma region AsSpan()
+
+	template<typename T>
+	inline Span<T> Datum::AsSpan()
+	{
+		if (mType != TypeOf<T>())
+		{
+			throw std::exception("The Datum's type does not match the span type.");
+		}
+
+		// Every member of the union points at the same storage
+		return Span<T>(static_cast<T*>(static_cast<void*>(mData.vp)), mSize);
+	}
+
+	template<typename T>
+	inline Span<const T> Datum::AsSpan() const
+	{
+		if (mType != TypeOf<T>())
+		{
+			throw std::exception("The Datum's type does not match the span type.");
+		}
+
+		return Span<const T>(static_cast<const T*>(static_cast<const void*>(mData.vp)), mSize);
+	}
+
+#pragma endregion
+}
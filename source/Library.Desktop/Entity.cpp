@@ -4,12 +4,15 @@ namespace Library
 {
 	RTTI_DEFINITIONS(Entity)
 
+	const Symbol Entity::sActionsName("actions");
+
 	Entity::Entity()
 		: mName()
 	{
 		AddExternalSignature("name", 1, &mName);
 		CreateTableDatum("actions");
 		Populate();
+		Actions();
 	}
 
 	Entity::Entity(const std::string& name)
@@ -18,6 +21,7 @@ namespace Library
 		AddExternalSignature("name", 1, &mName);
 		CreateTableDatum("actions");
 		Populate();
+		Actions();
 	}
 
 	Entity::Entity(const Entity& rhs)
@@ -36,15 +40,32 @@ namespace Library
 		return *this;
 	}
 
+	Entity::Entity(Entity&& rhs)
+		: Attributed(std::move(rhs)), mName(std::move(rhs.mName)), mActions()
+	{
+		MoveExternalStorage(rhs, sizeof(Entity));
+	}
+
+	Entity& Entity::operator=(Entity&& rhs)
+	{
+		if (this != &rhs)
+		{
+			Attributed::operator=(std::move(rhs));
+			mName = std::move(rhs.mName);
+			MoveExternalStorage(rhs, sizeof(Entity));
+		}
+
+		return *this;
+	}
+
 	Datum& Entity::Actions()
 	{
-		Datum* foundActions = Find("actions");
-		assert(foundActions != nullptr);
-		return *foundActions;
+		return FindCached(sActionsName, mActions);
 	}
 
 	Action& Entity::CreateAction(const std::string& className, const std::string& instanceName)
 	{
+		AllocatorGuard guard(GetAllocator());
 		Action* action = Factory<Action>::Create(className);
 		assert(action != nullptr);
 		action->SetName(instanceName);
@@ -94,4 +115,19 @@ namespace Library
 		state.action = nullptr;
 	}
 
+	bool Entity::IsParallelSafe() const
+	{
+		const Datum& actions = FindCached(sActionsName, mActions);
+		for (std::uint32_t i = 0; i < actions.Size(); ++i)
+		{
+			const Action* action = actions.Get<Scope*>(i)->As<Action>();
+			if (action == nullptr || !action->IsParallelSafe())
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+
 }
@@ -44,10 +44,19 @@ namespace Library
 		Entity& operator=(const Entity& rhs);
 
 		/**
-		 * Prevent an Entity from being moved, can re-enable when Attributed 
-		 * (and supporting containers) all support move semantics.
+		 * Move an Entity. Its Actions are re-parented to the new Entity.
+		 *
+		 * @param rhs the Entity to move from
+		 */
+		Entity(Entity&& rhs);
+
+		/**
+		 * Move an Entity. Its Actions are re-parented to this Entity.
+		 *
+		 * @param rhs the Entity to move from
+		 * @return a reference to this Entity
 		 */
-		Entity(Entity&& rhs) = delete;
+		Entity& operator=(Entity&& rhs);
 
 		/**
 		 * Default decnstructor.
@@ -105,8 +114,19 @@ namespace Library
 		 */
 		virtual void Update(WorldState& state);
 
+		/**
+		 * Returns whether every Action of the Entity is parallel-safe, so that the Entity can be
+		 * updated at the same time as other Entities.
+		 *
+		 * @return true if the Entity can be updated in parallel, false otherwise
+		 */
+		virtual bool IsParallelSafe() const;
+
 	private:
 		std::string mName;			/**< The name of the Entity */
+		mutable CachedAttribute mActions;	/**< The resolved "actions" Datum */
+
+		static const Symbol sActionsName;
 	};
 
 	ConcreteFactory(Entity, RTTI)
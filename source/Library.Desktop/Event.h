@@ -1,8 +1,7 @@
 #pragma once
 
-#include <mutex>
 #include "EventPublisher.h"
-#include "Vector.h"
+#include "SubscriberList.h"
 
 namespace Library
 {
@@ -10,6 +9,8 @@ namespace Library
 
 	/**
 	 * An Event represents the message payload that can be sent immediately or queued for future delivery.
+	 * Every Event of one message type shares a SubscriberList, so subscribing and unsubscribing never
+	 * hold up an Event that is being delivered.
 	 */
 	template<typename MessageT>
 	class Event final : public EventPublisher
@@ -60,10 +61,16 @@ namespace Library
 		 */
 		const MessageT& Message() const;
 
+		/**
+		 * Returns the message object for filling in, such as on an Event acquired from an EventPool.
+		 *
+		 * @return the message object
+		 */
+		MessageT& Message();
+
 	private:
 		MessageT mMessage;								/**< Message payload */
-		static Vector<IEventSubscriber*> mSubscribers;	/**< The list of subscribers */
-		static std::mutex mMutex;
+		static SubscriberList mSubscribers;				/**< The list of subscribers */
 	};
 }
 
@@ -6,10 +6,7 @@ namespace Library
 	RTTI_DEFINITIONS(Event<MessageT>)
 
 	template<typename MessageT>
-	Vector<IEventSubscriber*> Event<MessageT>::mSubscribers = Vector<IEventSubscriber*>();
-
-	template<typename MessageT>
-	std::mutex Event<MessageT>::mMutex;
+	SubscriberList Event<MessageT>::mSubscribers;
 
 	template<typename MessageT>
 	Event<MessageT>::Event(const MessageT& message)
@@ -20,28 +17,30 @@ namespace Library
 	template<typename MessageT>
 	void Event<MessageT>::Subscribe(IEventSubscriber& subscriber)
 	{
-		std::lock_guard<std::mutex> lock(mMutex);
-		mSubscribers.PushBack(&subscriber);
+		mSubscribers.Add(subscriber);
 	}
 
 	template<typename MessageT>
 	void Event<MessageT>::Unsubscribe(IEventSubscriber& subscriber)
 	{
-		std::lock_guard<std::mutex> lock(mMutex);
-		mSubscribers.Remove(&subscriber);
+		mSubscribers.Remove(subscriber);
 	}
 
 	template<typename MessageT>
 	void Event<MessageT>::UnsubscribeAll()
 	{
-		std::lock_guard<std::mutex> lock(mMutex);
 		mSubscribers.Clear();
 	}
 
 	template<typename MessageT>
 	const MessageT& Event<MessageT>::Message() const
 	{
-		std::lock_guard<std::mutex> lock(mMutex);
+		return mMessage;
+	}
+
+	template<typename MessageT>
+	MessageT& Event<MessageT>::Message()
+	{
 		return mMessage;
 	}
 
@@ -8,6 +8,7 @@ namespace Library
 	EventMessageAttributed::EventMessageAttributed(const std::string& subtype, World* world)
 		: mSubtype(subtype), mWorld(world)
 	{
+		Populate();
 	}
 
 	const std::string& EventMessageAttributed::GetSubtype() const
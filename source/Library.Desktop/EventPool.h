@@ -0,0 +1,73 @@
+#pragma once
+
+#include <cstdint>
+#include <mutex>
+#include "IEventPool.h"
+#include "Vector.h"
+
+namespace Library
+{
+	template<typename MessageT> class Event;
+
+	/**
+	 * Recycles the Events of one message type. Acquire hands out an Event that is not in flight,
+	 * creating one only when every Event the pool owns is still queued, and the EventQueue
+	 * releases it back once it has been delivered. Once the pool has grown to the largest
+	 * number of Events in flight at once, firing an Event allocates nothing. Message payloads are
+	 * reused as well, so a caller overwrites the fields it needs rather than starting from a
+	 * fresh message. Acquire and Release are thread-safe.
+	 */
+	template<typename MessageT>
+	class EventPool final : public IEventPool
+	{
+	public:
+		/**
+		 * Default constructor. No Events are created until the first Acquire.
+		 */
+		EventPool() = default;
+
+		// Pooled Events refer back to the pool they came from, so it cannot be copied
+		EventPool(const EventPool& rhs) = delete;
+		EventPool& operator=(const EventPool& rhs) = delete;
+
+		/**
+		 * Destructor. Deletes every Event the pool owns, including any still in flight.
+		 */
+		virtual ~EventPool();
+
+		/**
+		 * Returns an Event that is not in flight.
+		 *
+		 * @return a reference to the Event
+		 */
+		Event<MessageT>& Acquire();
+
+		/**
+		 * Takes back an Event that has finished being delivered. Called by the EventQueue.
+		 *
+		 * @param publisher the Event, which must have been acquired from this pool
+		 */
+		virtual void Release(EventPublisher& publisher) override;
+
+		/**
+		 * Returns the number of Events the pool owns, in flight or not.
+		 *
+		 * @return the number of Events
+		 */
+		std::uint32_t Size() const;
+
+		/**
+		 * Returns the number of Events that can be acquired without creating a new one.
+		 *
+		 * @return the number of Events not in flight
+		 */
+		std::uint32_t AvailableCount() const;
+
+	private:
+		Vector<Event<MessageT>*> mEvents;			/**< Every Event the pool owns */
+		Vector<Event<MessageT>*> mAvailable;		/**< The Events that are not in flight */
+		mutable std::mutex mMutex;					/**< Guards the two lists */
+	};
+}
+
+#include "EventPool.inl"
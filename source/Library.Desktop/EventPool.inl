@@ -0,0 +1,58 @@
+#include "pch.h"
+
+namespace Library
+{
+	template<typename MessageT>
+	EventPool<MessageT>::~EventPool()
+	{
+		for (Event<MessageT>* event : mEvents)
+		{
+			delete event;
+		}
+	}
+
+	template<typename MessageT>
+	Event<MessageT>& EventPool<MessageT>::Acquire()
+	{
+		std::lock_guard<std::mutex> lock(mMutex);
+		if (!mAvailable.IsEmpty())
+		{
+			Event<MessageT>* event = mAvailable.Back();
+			mAvailable.PopBack();
+			return *event;
+		}
+
+		Event<MessageT>* event = new Event<MessageT>(MessageT());
+		event->SetPool(this);
+		mEvents.PushBack(event);
+
+		// Room for every Event to come back, so Release never has to grow the list
+		mAvailable.Reserve(mEvents.Size());
+
+		return *event;
+	}
+
+	template<typename MessageT>
+	void EventPool<MessageT>::Release(EventPublisher& publisher)
+	{
+		Event<MessageT>* event = publisher.As<Event<MessageT>>();
+		assert(event != nullptr);
+
+		std::lock_guard<std::mutex> lock(mMutex);
+		mAvailable.PushBack(event);
+	}
+
+	template<typename MessageT>
+	std::uint32_t EventPool<MessageT>::Size() const
+	{
+		std::lock_guard<std::mutex> lock(mMutex);
+		return mEvents.Size();
+	}
+
+	template<typename MessageT>
+	std::uint32_t EventPool<MessageT>::AvailableCount() const
+	{
+		std::lock_guard<std::mutex> lock(mMutex);
+		return mAvailable.Size();
+	}
+}
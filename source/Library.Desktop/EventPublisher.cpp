@@ -8,7 +8,12 @@ namespace Library
 	typedef std::chrono::milliseconds Milliseconds;
 
 	EventPublisher::EventPublisher(Vector<IEventSubscriber*>& subscribers)
-		: mSubscribers(&subscribers)
+		: mSubscribers(&subscribers), mSubscriberList(nullptr), mPool(nullptr), mEnqueueCount(0)
+	{
+	}
+
+	EventPublisher::EventPublisher(const SubscriberList& subscribers)
+		: mSubscribers(nullptr), mSubscriberList(&subscribers), mPool(nullptr), mEnqueueCount(0)
 	{
 	}
 
@@ -20,19 +25,38 @@ namespace Library
 
 	void EventPublisher::Deliver() const
 	{
-		std::vector<std::future<void>> futures;
+		Deliver(JobSystem::Shared());
+	}
+
+	void EventPublisher::Deliver(JobSystem& jobSystem) const
+	{
+		// The snapshot stays alive until every subscriber in it has been notified, whatever the list does meanwhile
+		const SubscriberList::Snapshot snapshot = Subscribers();
+		if (snapshot == nullptr)
 		{
-			std::lock_guard<std::mutex> lock(mMutex);
-			for (auto& subscriber : *mSubscribers)
+			return;
+		}
+
+		// The lock is not held while notifying, since subscribers may ask the publisher for its times
+		const Vector<IEventSubscriber*>& subscribers = *snapshot;
+		jobSystem.ParallelFor(subscribers.Size(), SubscribersPerJob, [this, &subscribers](std::uint32_t begin, std::uint32_t end)
+		{
+			for (std::uint32_t i = begin; i < end; ++i)
 			{
-				futures.emplace_back(std::async(&IEventSubscriber::Notify, subscriber, std::ref(*this)));
+				subscribers[i]->Notify(*this);
 			}
-		}
+		});
+	}
 
-		for (auto& f : futures)
+	SubscriberList::Snapshot EventPublisher::Subscribers() const
+	{
+		if (mSubscriberList != nullptr)
 		{
-			f.get();
+			return mSubscriberList->GetSnapshot();
 		}
+
+		// A fixed list is not owned by the publisher, so the snapshot only points at it
+		return SubscriberList::Snapshot(SubscriberList::Snapshot(), mSubscribers);
 	}
 
 	const Milliseconds& EventPublisher::Delay() const
@@ -54,4 +78,27 @@ namespace Library
 		mDelay = delay;
 	}
 
+	void EventPublisher::SetPool(IEventPool* pool)
+	{
+		mPool = pool;
+	}
+
+	void EventPublisher::MarkEnqueued()
+	{
+		mEnqueueCount.fetch_add(1, std::memory_order_relaxed);
+	}
+
+	void EventPublisher::Recycle()
+	{
+		// An event that was never enqueued goes straight back; otherwise only the last trip to end hands it back
+		std::uint32_t count = mEnqueueCount.load(std::memory_order_relaxed);
+		while (count != 0 && !mEnqueueCount.compare_exchange_weak(count, count - 1, std::memory_order_acq_rel))
+		{
+		}
+
+		if (count <= 1 && mPool != nullptr)
+		{
+			mPool->Release(*this);
+		}
+	}
 }
@@ -1,12 +1,16 @@
 #pragma once
 
+#include <atomic>
 #include <chrono>
 #include <mutex>
 #include "RTTI.h"
+#include "JobSystem.h"
+#include "SubscriberList.h"
 
 namespace Library
 {
 	class IEventSubscriber;
+	class IEventPool;
 
 	/**
 	 * Responsible for delivering events to a list of subscribers.
@@ -20,10 +24,20 @@ namespace Library
 
 	public:
 		/**
-		 * Constructs an EventPublisher with a list of subscribers.
+		 * Constructs an EventPublisher with a fixed list of subscribers, which must not change
+		 * while the publisher is being delivered.
+		 *
+		 * @param subscribers the subscribers to notify
 		 */
 		explicit EventPublisher(Vector<IEventSubscriber*>& subscribers);
 
+		/**
+		 * Constructs an EventPublisher that notifies whoever is on a SubscriberList when it is delivered.
+		 *
+		 * @param subscribers the list of subscribers
+		 */
+		explicit EventPublisher(const SubscriberList& subscribers);
+
 		// Prevent publisher from being copied or moved
 		EventPublisher(const EventPublisher& rhs) = delete;
 		EventPublisher(EventPublisher&& rhs) = delete;
@@ -43,10 +57,29 @@ namespace Library
 		bool IsExpired(const TimePoint& currentTime) const;
 
 		/**
-		 * Notify all subscribers of this event.
+		 * Notify all subscribers of this event on the shared JobSystem.
 		 */
 		void Deliver() const;
 
+		/**
+		 * Notify all subscribers of this event. Subscribers are notified in batches of
+		 * SubscribersPerJob on the JobSystem's workers, and a short list is notified on the
+		 * calling thread without involving the workers at all. A SubscriberList is read from
+		 * a snapshot taken as delivery starts, without locking.
+		 *
+		 * @param jobSystem the JobSystem to notify the subscribers on
+		 */
+		void Deliver(JobSystem& jobSystem) const;
+
+		/**
+		 * Returns the subscribers that delivering this event would notify right now.
+		 *
+		 * @return a snapshot of the subscribers, or nullptr if there are none
+		 */
+		SubscriberList::Snapshot Subscribers() const;
+
+		static const std::uint32_t SubscribersPerJob = 8;		/**< The number of subscribers notified by one job */
+
 		/**
 		 *Returns the amount of time after being enqueued that this event expires.
 		 *
@@ -69,10 +102,33 @@ namespace Library
 		 */
 		void SetTime(const TimePoint& currentTime, const Milliseconds& delay = Milliseconds(0));
 
+		/**
+		 * Sets the pool this event is handed back to once it has been delivered.
+		 *
+		 * @param pool the pool that owns this event, or nullptr if the event is not pooled
+		 */
+		void SetPool(IEventPool* pool);
+
+		/**
+		 * Counts one more trip through an EventQueue. Called by the EventQueue as it takes the event,
+		 * so a subscriber can enqueue the event again while it is being delivered.
+		 */
+		void MarkEnqueued();
+
+		/**
+		 * Hands this event back to its pool, if it has one, once every trip through an EventQueue
+		 * has ended. Called by the EventQueue once the event has been delivered or dropped; the event
+		 * must not be used again until it is reacquired.
+		 */
+		void Recycle();
+
 	private:
-		Vector<IEventSubscriber*>* mSubscribers;	/**< Points to an Event's subscribers. */
+		Vector<IEventSubscriber*>* mSubscribers;	/**< Points to a fixed list of subscribers, if any. */
+		const SubscriberList* mSubscriberList;		/**< Points to an Event's subscribers, if any. */
+		IEventPool* mPool;							/**< The pool that owns this event, if any. */
 		TimePoint mEnqueuedTime;					/**< Time the event was enqueued. */
 		Milliseconds mDelay;						/**< Amount of time after being enqueued that an event expires. */
+		std::atomic<std::uint32_t> mEnqueueCount;	/**< The trips through an EventQueue that have not ended yet. */
 		mutable std::mutex mMutex;					/**< The mutex used to lock the EventPublisher. */
 	};
 }
@@ -4,81 +4,434 @@ namespace Library
 {
 	typedef std::chrono::milliseconds Milliseconds;
 
-	EventQueue::EventQueue()
-		: mEventQueue()
+	EventQueue::EventQueue(JobSystem& jobSystem)
+		: EventQueue(Strategy::Heap, jobSystem)
 	{
 	}
 
-	void EventQueue::Enqueue(EventPublisher& publisher, const GameTime& gameTime, const Milliseconds& delay)
+	EventQueue::EventQueue(const Strategy strategy, JobSystem& jobSystem)
+		: mIntake(), mSize(0), mStrategy(strategy), mEventQueue(), mTimingWheel(), mIsBatchDelivery(false),
+		mMaxEventsPerUpdate(0), mMaxTimePerUpdate(0), mHighWaterMark(0), mJobSystem(&jobSystem)
 	{
+	}
+
+	EventQueue::EventQueue(EventQueue&& rhs)
+		: mIntake(), mSize(0), mStrategy(rhs.mStrategy), mEventQueue(), mTimingWheel(), mIsBatchDelivery(false),
+		mMaxEventsPerUpdate(0), mMaxTimePerUpdate(0), mHighWaterMark(0), mJobSystem(rhs.mJobSystem)
+	{
+		operator=(std::move(rhs));
+	}
+
+	EventQueue& EventQueue::operator=(EventQueue&& rhs)
+	{
+		if (this != &rhs)
+		{
+			std::lock(mMutex, rhs.mMutex);
+			std::lock_guard<std::mutex> lock(mMutex, std::adopt_lock);
+			std::lock_guard<std::mutex> rhsLock(rhs.mMutex, std::adopt_lock);
+
+			// The intake queues stay put, so their events are moved over through the containers
+			Drain();
+			rhs.Drain();
+
+			mSize = rhs.mSize.exchange(0);
+			mStrategy = rhs.mStrategy;
+			mEventQueue = std::move(rhs.mEventQueue);
+			mTimingWheel = std::move(rhs.mTimingWheel);
+			mOverdueEvents = std::move(rhs.mOverdueEvents);
+			rhs.mOverdueEvents.clear();
+			mIsBatchDelivery = rhs.mIsBatchDelivery;
+			mMaxEventsPerUpdate = rhs.mMaxEventsPerUpdate;
+			mMaxTimePerUpdate = rhs.mMaxTimePerUpdate;
+			mHighWaterMark = rhs.mHighWaterMark.load();
+		}
+
+		return *this;
+	}
+
+	bool EventQueue::Enqueue(EventPublisher& publisher, const GameTime& gameTime, const Milliseconds& delay)
+	{
+		// A subscriber may enqueue the event again while it is being delivered, so it is only recycled once every trip has ended
+		publisher.MarkEnqueued();
+
 		if (delay <= Milliseconds(0))
 		{
 			// There was no delay, bypass the queue
 			Send(publisher);
+			publisher.Recycle();
+			return true;
 		}
-		else
-		{
-			// The delay is greater than zero, queue the event
-			publisher.SetTime(gameTime.CurrentTime(), delay);
 
-			// Wait to lock guard, we want an accurate timestamp on the publisher
-			std::lock_guard<std::mutex> lock(mMutex);
-			mEventQueue.PushBack(&publisher);
+		// Counted first, so an Update that drains the event before the count goes up cannot take the count below zero.
+		// The count also claims the event's place under the high-water mark, so producers racing each other cannot overshoot it.
+		const std::uint32_t highWaterMark = mHighWaterMark.load(std::memory_order_relaxed);
+		if (mSize.fetch_add(1, std::memory_order_relaxed) >= highWaterMark && highWaterMark != 0)
+		{
+			mSize.fetch_sub(1, std::memory_order_relaxed);
+			publisher.Recycle();
+			return false;
 		}
+
+		// The delay is greater than zero, queue the event
+		const TimePoint& currentTime = gameTime.CurrentTime();
+		publisher.SetTime(currentTime, delay);
+		mIntake.Push(PendingEvent{ &publisher, currentTime, currentTime + delay });
+
+		return true;
 	}
 
 	void EventQueue::Send(const EventPublisher& publisher) const
 	{
-		publisher.Deliver();
+		publisher.Deliver(*mJobSystem);
 	}
 
 	void EventQueue::Update(const GameTime& gameTime)
 	{
-		std::vector<std::future<void>> futures;
+		// The events are delivered outside the lock, so another Update may be running at the same time; each has buffers of its own
+		Delivery delivery;
+		std::vector<EventPublisher*>& expiredEvents = delivery.mExpiredEvents;
+		Milliseconds maxTime;
 		{
+			// Only the expired events are looked at, soonest first
 			std::lock_guard<std::mutex> lock(mMutex);
-			for (auto& message : mEventQueue)
+			std::swap(delivery, mSpareDelivery);
+			delivery.mIsBatched = mIsBatchDelivery;
+			maxTime = mMaxTimePerUpdate;
+			Drain();
+			Expire(gameTime.CurrentTime());
+
+			// As many of the overdue events as the budget allows are taken out to be delivered
+			std::uint32_t count = static_cast<std::uint32_t>(mOverdueEvents.size());
+			if (mMaxEventsPerUpdate != 0 && count > mMaxEventsPerUpdate)
+			{
+				count = mMaxEventsPerUpdate;
+			}
+			expiredEvents.assign(mOverdueEvents.begin(), mOverdueEvents.begin() + count);
+			mOverdueEvents.erase(mOverdueEvents.begin(), mOverdueEvents.begin() + count);
+		}
+
+		const std::uint32_t count = static_cast<std::uint32_t>(expiredEvents.size());
+		std::uint32_t delivered = 0;
+		if (delivery.mIsBatched)
+		{
+			delivered = DeliverBatches(delivery, maxTime);
+		}
+		else if (maxTime <= Milliseconds(0))
+		{
+			Deliver(delivery, 0, count);
+			delivered = count;
+		}
+		else
+		{
+			// Delivered a slice at a time, with one job per worker and one for this thread, so the clock can be checked in between
+			const auto deadline = std::chrono::high_resolution_clock::now() + maxTime;
+			const std::uint32_t sliceSize = EventsPerJob * (mJobSystem->WorkerCount() + 1);
+			while (delivered < count)
 			{
-				if (message->IsExpired(gameTime.CurrentTime()))
+				const std::uint32_t end = (count - delivered > sliceSize ? delivered + sliceSize : count);
+				Deliver(delivery, delivered, end);
+				delivered = end;
+
+				if (std::chrono::high_resolution_clock::now() >= deadline)
 				{
-					futures.emplace_back(std::async(std::launch::async, &EventPublisher::Deliver, message));
-					mExpiredEvents.emplace_back(message);
+					break;
 				}
 			}
 		}
-		
-		// Wait for all messages to be finished processing before trying to remove expired events
-		for (auto& f : futures)
+
+		// Pooled events can be reused once they have been delivered and are not queued again
+		for (std::uint32_t i = 0; i < delivered; ++i)
 		{
-			f.get();
+			expiredEvents[i]->Recycle();
 		}
 
 		{
+			// Whatever the time ran out on is first in line for the next Update
 			std::lock_guard<std::mutex> lock(mMutex);
-			for (auto& message : mExpiredEvents)
-			{
-				mEventQueue.Remove(message);
-			}
-			mExpiredEvents.clear();
+			mOverdueEvents.insert(mOverdueEvents.begin(), expiredEvents.begin() + delivered, expiredEvents.end());
+			mSize.fetch_sub(delivered, std::memory_order_relaxed);
+
+			expiredEvents.clear();
+			mSpareDelivery = std::move(delivery);
 		}
 	}
 
+	void EventQueue::SetBatchDelivery(const bool isBatched)
+	{
+		std::lock_guard<std::mutex> lock(mMutex);
+		mIsBatchDelivery = isBatched;
+	}
+
+	bool EventQueue::IsBatchDelivery() const
+	{
+		std::lock_guard<std::mutex> lock(mMutex);
+		return mIsBatchDelivery;
+	}
+
+	void EventQueue::SetDeliveryBudget(const std::uint32_t maxEvents, const Milliseconds& maxTime)
+	{
+		std::lock_guard<std::mutex> lock(mMutex);
+		mMaxEventsPerUpdate = maxEvents;
+		mMaxTimePerUpdate = maxTime;
+	}
+
+	std::uint32_t EventQueue::MaxEventsPerUpdate() const
+	{
+		std::lock_guard<std::mutex> lock(mMutex);
+		return mMaxEventsPerUpdate;
+	}
+
+	Milliseconds EventQueue::MaxTimePerUpdate() const
+	{
+		std::lock_guard<std::mutex> lock(mMutex);
+		return mMaxTimePerUpdate;
+	}
+
+	void EventQueue::SetHighWaterMark(const std::uint32_t limit)
+	{
+		mHighWaterMark.store(limit, std::memory_order_relaxed);
+	}
+
+	std::uint32_t EventQueue::HighWaterMark() const
+	{
+		return mHighWaterMark.load(std::memory_order_relaxed);
+	}
+
+	bool EventQueue::IsAtHighWaterMark() const
+	{
+		const std::uint32_t highWaterMark = mHighWaterMark.load(std::memory_order_relaxed);
+		return (highWaterMark != 0 && mSize.load(std::memory_order_relaxed) >= highWaterMark);
+	}
+
 	void EventQueue::Clear()
 	{
 		std::lock_guard<std::mutex> lock(mMutex);
-		mEventQueue.Clear();
+		Drain();
+
+		// Only the events drained here are discounted; any still being enqueued or delivered stay counted
+		mSize.fetch_sub(static_cast<std::uint32_t>(mOverdueEvents.size()) + mEventQueue.Size() + mTimingWheel.Size(), std::memory_order_relaxed);
+
+		// Pooled events that will never be delivered go back to their pools
+		for (EventPublisher* publisher : mOverdueEvents)
+		{
+			publisher->Recycle();
+		}
+		mOverdueEvents.clear();
+		while (!mEventQueue.IsEmpty())
+		{
+			mEventQueue.Pop().mPublisher->Recycle();
+		}
+		mTimingWheel.ForEach([](EventPublisher* publisher) { publisher->Recycle(); });
+		mTimingWheel.Clear();
 	}
 
-	bool EventQueue::IsEmpty() const
+	EventQueue::TimePoint EventQueue::NextExpiryTime()
 	{
 		std::lock_guard<std::mutex> lock(mMutex);
-		return mEventQueue.IsEmpty();
+		Drain();
+
+		if (!mOverdueEvents.empty())
+		{
+			return TimePoint::min();
+		}
+
+		if (mStrategy == Strategy::TimingWheel)
+		{
+			return mTimingWheel.NextExpiryTime();
+		}
+
+		return (mEventQueue.IsEmpty() ? TimePoint::max() : mEventQueue.Top().mExpiry);
+	}
+
+	EventQueue::Strategy EventQueue::GetStrategy() const
+	{
+		return mStrategy;
+	}
+
+	bool EventQueue::IsEmpty() const
+	{
+		return (mSize.load(std::memory_order_relaxed) == 0);
 	}
 
 	std::uint32_t EventQueue::Size() const
 	{
-		std::lock_guard<std::mutex> lock(mMutex);
-		return mEventQueue.Size();
+		return mSize.load(std::memory_order_relaxed);
+	}
+
+	void EventQueue::Expire(const TimePoint& currentTime)
+	{
+		if (mStrategy == Strategy::TimingWheel)
+		{
+			mTimingWheel.Advance(currentTime, [this](EventPublisher* publisher) { mOverdueEvents.push_back(publisher); });
+		}
+		else
+		{
+			// Events past the budget can stay in the heap, which still hands them out in order
+			while (!mEventQueue.IsEmpty() && currentTime > mEventQueue.Top().mExpiry &&
+				(mMaxEventsPerUpdate == 0 || mOverdueEvents.size() < mMaxEventsPerUpdate))
+			{
+				mOverdueEvents.push_back(mEventQueue.Pop().mPublisher);
+			}
+		}
+	}
+
+	void EventQueue::Deliver(Delivery& delivery, const std::uint32_t begin, const std::uint32_t end)
+	{
+		// ParallelFor returns once every expired event has been delivered
+		JobSystem& jobSystem = *mJobSystem;
+		const std::vector<EventPublisher*>& expiredEvents = delivery.mExpiredEvents;
+		jobSystem.ParallelFor(end - begin, EventsPerJob, [&expiredEvents, &jobSystem, begin](std::uint32_t first, std::uint32_t last)
+		{
+			for (std::uint32_t i = begin + first; i < begin + last; ++i)
+			{
+				expiredEvents[i]->Deliver(jobSystem);
+			}
+		});
+	}
+
+	std::uint32_t EventQueue::DeliverBatches(Delivery& delivery, const Milliseconds& maxTime)
+	{
+		std::vector<EventPublisher*>& expiredEvents = delivery.mExpiredEvents;
+		std::vector<ExpiredEvent>& batchEvents = delivery.mBatchEvents;
+		std::vector<const EventPublisher*>& publishers = delivery.mPublishers;
+		std::vector<Group>& groups = delivery.mGroups;
+
+		// Events of one type share their subscribers, so they end up next to each other, still in the order they expired
+		const std::uint32_t count = static_cast<std::uint32_t>(expiredEvents.size());
+		for (std::uint32_t i = 0; i < count; ++i)
+		{
+			batchEvents.push_back(ExpiredEvent{ expiredEvents[i]->Subscribers(), expiredEvents[i], i });
+		}
+		std::stable_sort(batchEvents.begin(), batchEvents.end(), [](const ExpiredEvent& lhs, const ExpiredEvent& rhs)
+		{
+			return std::less<const SubscriberList::Subscribers*>()(lhs.mSubscribers.get(), rhs.mSubscribers.get());
+		});
+
+		// Each group's events are laid out as one batch
+		std::uint32_t groupEnd;
+		for (std::uint32_t groupBegin = 0; groupBegin < count; groupBegin = groupEnd)
+		{
+			const SubscriberList::Subscribers* subscribers = batchEvents[groupBegin].mSubscribers.get();
+			for (groupEnd = groupBegin; groupEnd < count && batchEvents[groupEnd].mSubscribers.get() == subscribers; ++groupEnd)
+			{
+				publishers.push_back(batchEvents[groupEnd].mPublisher);
+			}
+			groups.push_back(Group{ groupBegin, groupEnd - groupBegin });
+		}
+
+		// With a time budget, whole groups are delivered a slice at a time so the clock can be checked in between
+		const std::uint32_t groupCount = static_cast<std::uint32_t>(groups.size());
+		const bool isTimed = (maxTime > Milliseconds(0));
+		const auto deadline = std::chrono::high_resolution_clock::now() + maxTime;
+		const std::uint32_t sliceSize = EventsPerJob * (mJobSystem->WorkerCount() + 1);
+		std::uint32_t deliveredGroups = 0;
+		std::uint32_t delivered = 0;
+		while (deliveredGroups < groupCount)
+		{
+			std::uint32_t sliceEnd = deliveredGroups;
+			std::uint32_t sliceEvents = 0;
+			do
+			{
+				sliceEvents += groups[sliceEnd].mCount;
+				++sliceEnd;
+			} while (sliceEnd < groupCount && (!isTimed || sliceEvents < sliceSize));
+
+			DeliverGroups(delivery, deliveredGroups, sliceEnd);
+			deliveredGroups = sliceEnd;
+			delivered += sliceEvents;
+
+			if (isTimed && std::chrono::high_resolution_clock::now() >= deadline)
+			{
+				break;
+			}
+		}
+
+		// The delivered events go first, and the rest go back in the order they expired, so they keep their place in line
+		std::sort(batchEvents.begin() + delivered, batchEvents.end(), [](const ExpiredEvent& lhs, const ExpiredEvent& rhs)
+		{
+			return lhs.mIndex < rhs.mIndex;
+		});
+		for (std::uint32_t i = 0; i < count; ++i)
+		{
+			expiredEvents[i] = batchEvents[i].mPublisher;
+		}
+
+		batchEvents.clear();
+		publishers.clear();
+		groups.clear();
+		return delivered;
+	}
+
+	void EventQueue::DeliverGroups(Delivery& delivery, const std::uint32_t firstGroup, const std::uint32_t lastGroup)
+	{
+		const std::vector<ExpiredEvent>& batchEvents = delivery.mBatchEvents;
+		const std::vector<const EventPublisher*>& publishers = delivery.mPublishers;
+		const std::vector<Group>& groups = delivery.mGroups;
+		std::vector<Subscription>& subscriptions = delivery.mSubscriptions;
+		std::vector<BatchJob>& batchJobs = delivery.mBatchJobs;
+
+		// A subscriber of several groups has them next to each other, in group order
+		for (std::uint32_t group = firstGroup; group < lastGroup; ++group)
+		{
+			const SubscriberList::Subscribers* subscribers = batchEvents[groups[group].mBegin].mSubscribers.get();
+			if (subscribers != nullptr)
+			{
+				for (std::uint32_t i = 0; i < subscribers->Size(); ++i)
+				{
+					subscriptions.push_back(Subscription{ (*subscribers)[i], group });
+				}
+			}
+		}
+		std::stable_sort(subscriptions.begin(), subscriptions.end(), [](const Subscription& lhs, const Subscription& rhs)
+		{
+			return std::less<IEventSubscriber*>()(lhs.mSubscriber, rhs.mSubscriber);
+		});
+
+		// Each subscriber is one job, so it is never handed two batches at once
+		const std::uint32_t subscriptionCount = static_cast<std::uint32_t>(subscriptions.size());
+		std::uint32_t jobEnd;
+		for (std::uint32_t jobBegin = 0; jobBegin < subscriptionCount; jobBegin = jobEnd)
+		{
+			IEventSubscriber* subscriber = subscriptions[jobBegin].mSubscriber;
+			jobEnd = jobBegin + 1;
+			while (jobEnd < subscriptionCount && subscriptions[jobEnd].mSubscriber == subscriber)
+			{
+				++jobEnd;
+			}
+			batchJobs.push_back(BatchJob{ subscriber, jobBegin, jobEnd - jobBegin });
+		}
+
+		mJobSystem->ParallelFor(static_cast<std::uint32_t>(batchJobs.size()), 1, [&batchJobs, &subscriptions, &groups, &publishers](std::uint32_t first, std::uint32_t last)
+		{
+			for (std::uint32_t i = first; i < last; ++i)
+			{
+				const BatchJob& job = batchJobs[i];
+				for (std::uint32_t j = job.mBegin; j < job.mBegin + job.mCount; ++j)
+				{
+					const Group& group = groups[subscriptions[j].mGroup];
+					job.mSubscriber->NotifyBatch(Span<const EventPublisher* const>(&publishers[group.mBegin], group.mCount));
+				}
+			}
+		});
+
+		subscriptions.clear();
+		batchJobs.clear();
+	}
+
+	void EventQueue::Drain()
+	{
+		PendingEvent event;
+		while (mIntake.TryPop(event))
+		{
+			if (mStrategy == Strategy::TimingWheel)
+			{
+				mTimingWheel.Insert(event.mPublisher, event.mExpiry, event.mEnqueued);
+			}
+			else
+			{
+				mEventQueue.Push(QueuedEvent{ event.mExpiry, event.mPublisher });
+			}
+		}
 	}
 
 }
@@ -2,43 +2,102 @@
 
 #include <cstdint>
 #include <chrono>
+#include <deque>
 #include <mutex>
+#include "JobSystem.h"
+#include "SubscriberList.h"
 
 namespace Library
 {
 	class EventPublisher;
 	class GameTime;
+	class IEventSubscriber;
 
 	typedef std::chrono::milliseconds Milliseconds;
 
 	/**
-	 * Handles the sending of Events. Supports both immediate and delayed sending.
+	 * Handles the sending of Events. Supports both immediate and delayed sending. Delayed
+	 * Events are kept in a min-heap ordered by the time they expire, or in a hierarchical
+	 * timing wheel, so an Update only looks at the Events that have expired.
+	 *
+	 * Enqueue never takes a lock: new Events go onto a lock-free intake queue, which the next
+	 * Update drains into the heap or wheel in one step, so threads that enqueue at the same time
+	 * never block each other. Size and IsEmpty are lock-free as well.
+	 *
+	 * Expired Events are delivered one at a time by default. With batch delivery on, an Update
+	 * groups the Events that expired by the subscribers they go to, and each subscriber gets
+	 * one call to IEventSubscriber::NotifyBatch per group instead of one Notify per Event.
+	 *
+	 * To keep a burst of Events from stalling a frame, an Update can be given a budget of Events
+	 * or of time; whatever expired but did not fit is carried over to the next Update, ahead of
+	 * anything that expires later. A high-water mark makes Enqueue turn Events away while the
+	 * queue is full, so producers find out they are outpacing delivery.
 	 */
 	class EventQueue final
 	{
 	public:
+		typedef std::chrono::high_resolution_clock::time_point TimePoint;
+
 		/**
-		 * Default constructor.
+		 * How delayed Events are kept.
+		 */
+		enum class Strategy
+		{
+			Heap,			/**< A min-heap: O(log n) to enqueue and to expire an Event, exact to the nanosecond */
+			TimingWheel		/**< A timing wheel with millisecond ticks: O(1) to enqueue and O(1) amortized to expire an Event */
+		};
+
+		/**
+		 * Constructor.
+		 *
+		 * @param jobSystem the JobSystem that expired events are delivered on
+		 */
+		explicit EventQueue(JobSystem& jobSystem = JobSystem::Shared());
+
+		/**
+		 * Constructor.
+		 *
+		 * @param strategy how delayed events are kept
+		 * @param jobSystem the JobSystem that expired events are delivered on
 		 */
-		EventQueue();
+		explicit EventQueue(const Strategy strategy, JobSystem& jobSystem = JobSystem::Shared());
 
 		// Prevent copying
 		EventQueue(const EventQueue& rhs) = delete;
 		EventQueue& operator=(const EventQueue& rhs) = delete;
 
+		/**
+		 * Move constructor. Takes over the queued Events of the other queue, which is left empty.
+		 *
+		 * @param rhs the queue to move from
+		 */
+		EventQueue(EventQueue&& rhs);
+
+		/**
+		 * Move assignment operator. Takes over the queued Events of the other queue, which is left empty.
+		 *
+		 * @param rhs the queue to move from
+		 * @return a reference to this queue
+		 */
+		EventQueue& operator=(EventQueue&& rhs);
+
 		/**
 		 * Default destructor.
 		 */
 		~EventQueue() = default;
 
 		/**
-		 * Add the Event to a queue.
+		 * Add the Event to a queue. Safe to call from any thread without blocking. An Event
+		 * acquired from an EventPool is handed back to it once it has been delivered, or right
+		 * away if it is turned away. A subscriber may enqueue the Event again while it is being
+		 * delivered; it then goes back to its pool only after that delivery as well.
 		 *
 		 * @param publisher the event publisher
 		 * @param gameTime used to get the current time
 		 * @param delay optional parameter for the delay time
+		 * @return false if the queue was at its high-water mark and the Event was not queued, true otherwise
 		 */
-		void Enqueue(EventPublisher& publisher, const GameTime& gameTime, const Milliseconds& delay = Milliseconds(0));
+		bool Enqueue(EventPublisher& publisher, const GameTime& gameTime, const Milliseconds& delay = Milliseconds(0));
 
 		/**
 		 * Immediately sends an Event.
@@ -48,32 +107,198 @@ namespace Library
 		void Send(const EventPublisher& publisher) const;
 
 		/**
-		 * Publishes any expired events.
+		 * Publishes any expired events. Only the expired events are taken out of the heap or
+		 * the timing wheel, and they are delivered in batches of EventsPerJob on the queue's JobSystem, so no
+		 * threads are created while updating. Stops once the delivery budget is spent, leaving the
+		 * rest of the expired events for the next Update. Several threads may update at once, as
+		 * may a subscriber during delivery; each Update delivers only the events it took out.
 		 *
 		 * @gameTime used to ge the time
 		 */
 		void Update(const GameTime& gameTime);
 
 		/**
-		 * Clears the event queue.
+		 * Limits how much an Update delivers. The time budget is checked between slices of
+		 * events, so an Update can run over it by one slice, and always delivers at least one slice.
+		 * Safe to call from any thread; an Update that has already started keeps the budget it
+		 * started with.
+		 *
+		 * @param maxEvents the most events one Update delivers, or 0 for no limit
+		 * @param maxTime the time after which an Update stops delivering, or 0 for no limit
+		 */
+		void SetDeliveryBudget(const std::uint32_t maxEvents, const Milliseconds& maxTime = Milliseconds(0));
+
+		/**
+		 * Returns the most events one Update delivers.
+		 *
+		 * @return the largest number of events, or 0 if there is no limit
+		 */
+		std::uint32_t MaxEventsPerUpdate() const;
+
+		/**
+		 * Returns the time after which an Update stops delivering.
+		 *
+		 * @return the time budget, or 0 if there is no limit
+		 */
+		Milliseconds MaxTimePerUpdate() const;
+
+		/**
+		 * Sets how many events the queue holds before Enqueue turns new ones away. Events
+		 * already queued are kept when the limit is lowered. Safe to call from any thread.
+		 *
+		 * @param limit the largest number of queued events, or 0 for no limit
+		 */
+		void SetHighWaterMark(const std::uint32_t limit);
+
+		/**
+		 * Returns how many events the queue holds before Enqueue turns new ones away.
+		 *
+		 * @return the largest number of queued events, or 0 if there is no limit
+		 */
+		std::uint32_t HighWaterMark() const;
+
+		/**
+		 * Returns whether the queue is full, so producers can hold back before Enqueue starts failing.
+		 *
+		 * @return true if the queue holds as many events as its high-water mark allows, false otherwise
+		 */
+		bool IsAtHighWaterMark() const;
+
+		/**
+		 * Sets whether Update delivers the expired events in batches. In a batch, the events that
+		 * notify the same subscribers are handed to each of them at once, in the order they
+		 * expired, through IEventSubscriber::NotifyBatch. Each subscriber is one job per Update,
+		 * which is handed its batches one after another, so it is never notified on two threads
+		 * at once. With a time budget, the events are grouped before they are sliced and a slice
+		 * only holds whole batches, so a subscriber is one job per slice instead.
+		 *
+		 * Safe to call from any thread; an Update that has already started delivers the way it started.
+		 *
+		 * @param isBatched true to deliver in batches, false to deliver each event on its own
+		 */
+		void SetBatchDelivery(const bool isBatched);
+
+		/**
+		 * Returns whether Update delivers the expired events in batches.
+		 *
+		 * @return true if events are delivered in batches, false otherwise
+		 */
+		bool IsBatchDelivery() const;
+
+		/**
+		 * Clears the event queue. Pooled events are handed back to their pools.
 		 */
 		void Clear();
 
 		/**
-		 * Returns a boolean indicating the emptiness of the queue.
+		 * Returns a boolean indicating the emptiness of the queue. Events being enqueued on
+		 * other threads at the same time may or may not be counted.
 		 */
 		bool IsEmpty() const;
 
 		/**
-		 * Returns the number of events in the queue.
+		 * Returns the number of events in the queue. Events being enqueued on other threads at
+		 * the same time may or may not be counted.
 		 *
 		 * @return the number of events in the queue
 		 */
 		std::uint32_t Size() const;
 
+		/**
+		 * Returns when the next queued event expires, so a caller can sleep until then. An
+		 * event is delivered by the first Update whose time is past this point. Drains the
+		 * intake queue first, so events enqueued since the last Update are included.
+		 *
+		 * @return the expiry time of the soonest event, TimePoint::min() if expired events were
+		 * carried over from the last Update, or TimePoint::max() if the queue is empty
+		 */
+		TimePoint NextExpiryTime();
+
+		/**
+		 * Returns how delayed events are kept.
+		 *
+		 * @return the strategy chosen at construction
+		 */
+		Strategy GetStrategy() const;
+
+		static const std::uint32_t EventsPerJob = 4;		/**< The number of expired events delivered by one job */
+
 	private:
-		SList<EventPublisher*> mEventQueue;					/**< The queue of Events */
-		std::vector<EventPublisher*> mExpiredEvents;		/**< The list of expired events */
-		mutable std::mutex mMutex;							/**< The mutex used to lock the EventQueue. */
+		struct QueuedEvent
+		{
+			TimePoint mExpiry;					/**< When the Event expires */
+			EventPublisher* mPublisher;			/**< The Event */
+
+			bool operator<(const QueuedEvent& other) const { return mExpiry < other.mExpiry; }
+		};
+
+		struct PendingEvent
+		{
+			EventPublisher* mPublisher;			/**< The Event */
+			TimePoint mEnqueued;				/**< When the Event was enqueued */
+			TimePoint mExpiry;					/**< When the Event expires */
+		};
+
+		struct ExpiredEvent
+		{
+			SubscriberList::Snapshot mSubscribers;		/**< The subscribers the Event goes to */
+			EventPublisher* mPublisher;					/**< The Event */
+			std::uint32_t mIndex;						/**< Where the Event was in the order they expired */
+		};
+
+		struct Group
+		{
+			std::uint32_t mBegin;				/**< The first Event of the group in mPublishers */
+			std::uint32_t mCount;				/**< The number of Events in the group */
+		};
+
+		struct Subscription
+		{
+			IEventSubscriber* mSubscriber;		/**< A subscriber of the group */
+			std::uint32_t mGroup;				/**< The group in mGroups */
+		};
+
+		struct BatchJob
+		{
+			IEventSubscriber* mSubscriber;		/**< The subscriber to notify */
+			std::uint32_t mBegin;				/**< The subscriber's first group in mSubscriptions */
+			std::uint32_t mCount;				/**< The number of groups the subscriber is handed */
+		};
+
+		/**
+		 * The events one Update delivers, and the scratch space to deliver them in batches. Each
+		 * Update takes its own under the lock, so Updates that overlap, including one called by a
+		 * subscriber, never share one.
+		 */
+		struct Delivery
+		{
+			std::vector<EventPublisher*> mExpiredEvents;		/**< The events being delivered */
+			std::vector<ExpiredEvent> mBatchEvents;				/**< The expired events, grouped by their subscribers */
+			std::vector<const EventPublisher*> mPublishers;		/**< The expired events, one contiguous batch per group */
+			std::vector<Group> mGroups;							/**< The events that go to the same subscribers */
+			std::vector<Subscription> mSubscriptions;			/**< The groups of a slice, by subscriber */
+			std::vector<BatchJob> mBatchJobs;					/**< One job for each subscriber of a slice */
+			bool mIsBatched;									/**< Whether the Update delivers in batches, as set when it started */
+		};
+
+		void Drain();
+		void Expire(const TimePoint& currentTime);
+		void Deliver(Delivery& delivery, const std::uint32_t begin, const std::uint32_t end);
+		std::uint32_t DeliverBatches(Delivery& delivery, const Milliseconds& maxTime);
+		void DeliverGroups(Delivery& delivery, const std::uint32_t firstGroup, const std::uint32_t lastGroup);
+
+		MpscQueue<PendingEvent> mIntake;					/**< Events enqueued since the last drain */
+		std::atomic<std::uint32_t> mSize;					/**< The number of queued Events, including the intake */
+		Strategy mStrategy;									/**< Which of the two containers holds the queued Events */
+		PriorityQueue<QueuedEvent> mEventQueue;				/**< The queued Events, soonest first */
+		TimingWheel<EventPublisher*> mTimingWheel;			/**< The queued Events, by the tick they expire on */
+		std::deque<EventPublisher*> mOverdueEvents;			/**< Expired events carried over from earlier Updates, in the order they expired */
+		Delivery mSpareDelivery;							/**< Buffers handed back by the last Update, so the next one need not allocate */
+		bool mIsBatchDelivery;								/**< Whether Update delivers in batches */
+		std::uint32_t mMaxEventsPerUpdate;					/**< The most events one Update delivers, or 0 */
+		Milliseconds mMaxTimePerUpdate;						/**< How long one Update may spend delivering, or 0 */
+		std::atomic<std::uint32_t> mHighWaterMark;			/**< The most events the queue holds, or 0 */
+		mutable std::mutex mMutex;							/**< Lets one thread at a time drain and expire Events, and guards the delivery settings */
+		JobSystem* mJobSystem;								/**< Where expired events are delivered */
 	};
 }
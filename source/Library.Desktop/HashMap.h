@@ -1,11 +1,55 @@
 #pragma once
 
 #include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <utility>
 
 namespace Library
 {
 	/**
-	 * @brief The default hash function to use for a HashMap.
+	 * Hashes a block of memory a machine word at a time. Each 8-byte word is folded in with an
+	 * FNV-1a style xor-multiply and the result is run through a 64-bit finalizer, so keys that
+	 * share a long prefix or differ in a single trailing byte still land far apart.
+	 *
+	 * @param data the memory to hash
+	 * @param length the number of bytes to hash
+	 * @return the hash of the memory
+	 */
+	inline std::uint32_t HashBytes(const void* data, std::size_t length)
+	{
+		const std::uint64_t Prime = 0x100000001B3ULL;
+		const unsigned char* bytes = reinterpret_cast<const unsigned char*>(data);
+		std::uint64_t hash = 0xCBF29CE484222325ULL ^ (length * Prime);
+
+		for (; length >= sizeof(std::uint64_t); length -= sizeof(std::uint64_t), bytes += sizeof(std::uint64_t))
+		{
+			std::uint64_t word;
+			std::memcpy(&word, bytes, sizeof(word));
+			hash = (hash ^ word) * Prime;
+			hash ^= hash >> 29;
+		}
+
+		if (length > 0)
+		{
+			std::uint64_t word = 0;
+			std::memcpy(&word, bytes, length);
+			hash = (hash ^ word) * Prime;
+		}
+
+		// MurmurHash3 finalizer: every input bit affects every output bit
+		hash ^= hash >> 33;
+		hash *= 0xFF51AFD7ED558CCDULL;
+		hash ^= hash >> 33;
+		hash *= 0xC4CEB9FE1A85EC53ULL;
+		hash ^= hash >> 33;
+
+		return static_cast<std::uint32_t>(hash ^ (hash >> 32));
+	}
+
+	/**
+	 * @brief The default hash function to use for a HashMap. Hashes the bytes of the key, which
+	 * suits integers, pointers and other trivially copyable types.
 	 */
 	template<typename TKey>
 	class DefaultHash
@@ -15,18 +59,11 @@ namespace Library
 		 * Overloads operator() to return a hash index.
 		 *
 		 * @param key the key to hash
-		 * @param size the number of buckets
-		 * @return the newly hashed index
+		 * @return the hash of the key
 		 */
-		std::uint32_t operator()(const TKey& key)
+		std::uint32_t operator()(const TKey& key) const
 		{
-			const char* byte = reinterpret_cast<const char*>(&key);
-			std::uint32_t hash = 0;
-			for (std::uint32_t i = 0; i < sizeof(key); ++i)
-			{
-				hash = hash << 1 ^ byte[i];
-			}
-			return hash;
+			return HashBytes(&key, sizeof(key));
 		}
 	};
 
@@ -41,17 +78,11 @@ namespace Library
 		 * Overloads operator() to return a hash index.
 		 *
 		 * @param key the key to hash
-		 * @param size the number of buckets
-		 * @return the newly hashed index
+		 * @return the hash of the string contents
 		 */
-		std::uint32_t operator()(const char* key)
+		std::uint32_t operator()(const char* key) const
 		{
-			std::uint32_t hash = 0;
-			while (*key)
-			{
-				hash = hash << 1 ^ *key++;
-			}
-			return hash;
+			return HashBytes(key, std::strlen(key));
 		}
 	};
 
@@ -66,23 +97,34 @@ namespace Library
 		 * Overloads operator() to return a hash index.
 		 *
 		 * @param key the key to hash
-		 * @param size the number of buckets
-		 * @return the newly hashed index
+		 * @return the hash of the string contents
+		 */
+		std::uint32_t operator()(const std::string& key) const
+		{
+			return HashBytes(key.data(), key.length());
+		}
+
+		/**
+		 * Hashes a C string the same way as a std::string with the same contents, so that
+		 * string keys can be looked up without constructing a std::string.
+		 *
+		 * @param key the key to hash
+		 * @return the hash of the string contents
 		 */
-		std::uint32_t operator()(const std::string& key)
+		std::uint32_t operator()(const char* key) const
 		{
-			std::uint32_t hash = 0;
-			for (std::uint32_t i = 0; i < key.length(); ++i)
-			{
-				hash = hash << 1 ^ key[i];
-			}
-			return hash;
+			return HashBytes(key, std::strlen(key));
 		}
 	};
 
 	/**
 	 * A container that holds key/value pairs. The key is used as a unique identifier
 	 * while the value (or data) is what the container is looking to retrieve efficiently.
+	 *
+	 * The table uses open addressing with Robin Hood probing. Every bucket lives in a single
+	 * contiguous array and stores its pair inline, so a lookup touches one or two cache lines
+	 * and an insert never allocates unless the table has to grow. Because entries are shifted
+	 * in place, inserting or removing an entry invalidates existing iterators and pointers.
 	 */
 	template<typename TKey, typename TData, typename HashFunctor = DefaultHash<TKey>>
 	class HashMap
@@ -91,12 +133,32 @@ namespace Library
 		typedef std::pair<TKey, TData> PairType;							/**< The key/value pair for a HashMap */
 
 	private:
-		typedef SList<PairType> ChainType;
-		typedef Vector<ChainType> BucketType;
-		typedef typename ChainType::Iterator ChainIterator;
+		/**
+		 * @brief A single slot in the table, holding its pair inline.
+		 */
+		struct Bucket
+		{
+			std::uint32_t mProbeLength;		/**< Distance from the home bucket plus one, zero when the bucket is empty */
+			std::uint32_t mHash;			/**< The cached hash of the key, used to skip key comparisons and to rehash */
+			typename std::aligned_storage<sizeof(PairType), alignof(PairType)>::type mStorage;
+
+			PairType& Pair() { return *reinterpret_cast<PairType*>(&mStorage); }
+			const PairType& Pair() const { return *reinterpret_cast<const PairType*>(&mStorage); }
+			bool IsEmpty() const { return (mProbeLength == 0); }
+		};
 
-		BucketType mBuckets;
-		std::uint32_t mSize;
+		static const std::uint32_t MinimumCapacity = 4U;				/**< The smallest number of buckets a table will allocate */
+
+		Bucket* mBuckets;				/**< The contiguous array of buckets */
+		std::uint32_t mCapacity;		/**< The number of buckets, always a power of two */
+		std::uint32_t mShift;			/**< Right shift applied to the scrambled hash to produce a bucket index */
+		std::uint32_t mSize;			/**< The number of entries in the table */
+		std::uint32_t mGrowThreshold;	/**< The number of entries the table can hold before it has to grow */
+		float mMaxLoadFactor;			/**< The largest ratio of entries to buckets before the table grows */
+		Allocator* mAllocator;			/**< Where the bucket array comes from */
+
+	public:
+		static const float DefaultMaxLoadFactor;						/**< The max load factor a table starts with */
 
 	public:
 		/**
@@ -176,23 +238,54 @@ namespace Library
 			~Iterator() = default;
 		private:
 			friend class HashMap;
-			Iterator(const HashMap* owner, typename ChainType::Iterator chainIterator, const std::uint32_t index);
+			Iterator(const HashMap* owner, const std::uint32_t index);
 			const HashMap* mOwner;
-			typename ChainType::Iterator mNodeInChain;
 			std::uint32_t mIndex;
 		};
 
 		/**
 		 * Default constructor that sets the size of the hash table array.
 		 *
-		 * @param size the size (number of buckets) of the hash table array
+		 * @param size the minimum number of buckets in the hash table array
+		 * @param maxLoadFactor the largest ratio of entries to buckets before the table grows, in the range (0, 1]
+		 * @param allocator the Allocator the bucket array comes from
+		 */
+		HashMap(std::uint32_t sizeOfTable = 0, float maxLoadFactor = DefaultMaxLoadFactor, Allocator& allocator = Allocator::Default());
+
+		/**
+		 * Copy constructor that performs a deep copy.
+		 *
+		 * @param rhs the other HashMap to copy from
 		 */
-		HashMap(std::uint32_t sizeOfTable = 0);
+		HashMap(const HashMap& rhs);
+
+		/**
+		 * Move constructor. The HashMap's Allocator moves along with its buckets.
+		 *
+		 * @param rhs the HashMap to move
+		 */
+		HashMap(HashMap&& rhs);
+
+		/**
+		 * Assignment operator to perform a deep copy.
+		 *
+		 * @param rhs the other HashMap to copy from
+		 * @return a reference to this HashMap
+		 */
+		HashMap& operator=(const HashMap& rhs);
+
+		/**
+		 * Assignment operator that moves a HashMap. The HashMap's Allocator moves along with its buckets.
+		 *
+		 * @param rhs the HashMap to move
+		 * @return a reference to this HashMap
+		 */
+		HashMap& operator=(HashMap&& rhs);
 
 		/**
 		 * Destruct the object and free all memory associated with it.
 		 */
-		~HashMap() = default;
+		~HashMap();
 
 		/**
 		* Returns an Iterator associated with the TKey provided.
@@ -206,11 +299,22 @@ namespace Library
 		 * Returns an Iterator associated with the TKey provided.
 		 *
 		 * @param key a reference to the TKey being searched for
-		 * @param hashIndex reference to an unsigned integer index
+		 * @param hashIndex reference to an unsigned integer index, set to the home bucket of the key
 		 * @return an Iterator associated with the TKey provided
 		 */
 		Iterator Find(const TKey& key, std::uint32_t& hashIndex) const;
 
+		/**
+		 * Returns an Iterator associated with a key that is not a TKey but can be hashed by the
+		 * HashFunctor and compared against a TKey, such as a string literal for a std::string key.
+		 * This avoids building a temporary TKey just to perform the lookup.
+		 *
+		 * @param key the key being searched for
+		 * @return an Iterator associated with the key provided
+		 */
+		template<typename TLookup, typename = decltype(std::declval<HashFunctor&>()(std::declval<const TLookup&>()))>
+		Iterator Find(const TLookup& key) const;
+
 		/**
 		 * Inserts an entry (TKey, TData) into the table. If the table already contains
 		 * an entry with a matching TKey, it will not be modified.
@@ -247,7 +351,7 @@ namespace Library
 		void Remove(const TKey& key);
 
 		/**
-		 * Empties the table and deletes any memory it allocated.
+		 * Empties the table. The bucket array is kept so that refilling the table does not allocate.
 		 */
 		void Clear();
 
@@ -258,6 +362,51 @@ namespace Library
 		 */
 		std::uint32_t Size() const;
 
+		/**
+		 * Returns the number of buckets in the table.
+		 *
+		 * @return the number of buckets in the table
+		 */
+		std::uint32_t Capacity() const;
+
+		/**
+		 * Returns the current ratio of entries to buckets.
+		 *
+		 * @return the current load factor
+		 */
+		float LoadFactor() const;
+
+		/**
+		 * Returns the largest ratio of entries to buckets the table allows before it grows.
+		 *
+		 * @return the max load factor
+		 */
+		float MaxLoadFactor() const;
+
+		/**
+		 * Sets the largest ratio of entries to buckets the table allows before it grows.
+		 * The table is rehashed immediately if it is already over the new limit.
+		 *
+		 * @param maxLoadFactor the new max load factor, in the range (0, 1]
+		 */
+		void SetMaxLoadFactor(float maxLoadFactor);
+
+		/**
+		 * Makes room for at least the given number of entries without growing again.
+		 *
+		 * @param size the number of entries to make room for
+		 */
+		void Reserve(std::uint32_t size);
+
+		/**
+		 * Rebuilds the table with at least the given number of buckets. The bucket count never
+		 * drops below what the current entries need under the max load factor, so passing zero
+		 * shrinks the table as far as it can go.
+		 *
+		 * @param sizeOfTable the minimum number of buckets
+		 */
+		void Rehash(std::uint32_t sizeOfTable);
+
 		/**
 		 * Returns a boolean indicating the presence of a specified key within the hash map.
 		 *
@@ -279,6 +428,17 @@ namespace Library
 		 * @return an Iterator that can be used to determine when a loop is done
 		 */
 		Iterator end() const;
+
+	private:
+		std::uint32_t HomeIndex(const std::uint32_t hash) const;
+		template<typename TLookup>
+		std::uint32_t FindIndex(const TLookup& key, const std::uint32_t hash) const;
+		std::uint32_t InsertNew(PairType&& entry, const std::uint32_t hash);
+		void Allocate(const std::uint32_t capacity);
+		void ReleaseBuckets(Bucket* buckets, const std::uint32_t capacity);
+		void Rebuild(const std::uint32_t capacity);
+		std::uint32_t BucketsNeededFor(const std::uint32_t size) const;
+		void DestroyAll();
 	};
 }
 
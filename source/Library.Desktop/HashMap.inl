@@ -7,19 +7,19 @@ namespace Library
 
 	template<typename TKey, typename TData, typename HashFunctor>
 	HashMap<TKey, TData, HashFunctor>::Iterator::Iterator() :
-		mOwner(nullptr), mNodeInChain(nullptr), mIndex(0)
+		mOwner(nullptr), mIndex(0)
 	{
 	}
 
 	template<typename TKey, typename TData, typename HashFunctor>
-	HashMap<TKey, TData, HashFunctor>::Iterator::Iterator(const HashMap* owner, typename ChainType::Iterator chainIterator, const std::uint32_t index) :
-		mOwner(owner), mNodeInChain(chainIterator), mIndex(index)
+	HashMap<TKey, TData, HashFunctor>::Iterator::Iterator(const HashMap* owner, const std::uint32_t index) :
+		mOwner(owner), mIndex(index)
 	{
 	}
 
 	template<typename TKey, typename TData, typename HashFunctor>
 	HashMap<TKey, TData, HashFunctor>::Iterator::Iterator(const Iterator& rhs) :
-		mOwner(rhs.mOwner), mNodeInChain(rhs.mNodeInChain), mIndex(rhs.mIndex)
+		mOwner(rhs.mOwner), mIndex(rhs.mIndex)
 	{
 	}
 
@@ -30,7 +30,6 @@ namespace Library
 		{
 			mOwner = rhs.mOwner;
 			mIndex = rhs.mIndex;
-			mNodeInChain = rhs.mNodeInChain;
 		}
 
 		return *this;
@@ -39,30 +38,15 @@ namespace Library
 	template<typename TKey, typename TData, typename HashFunctor>
 	typename HashMap<TKey, TData, HashFunctor>::Iterator& HashMap<TKey, TData, HashFunctor>::Iterator::operator++()
 	{
-		if (mOwner == nullptr || mIndex == mOwner->mBuckets.Size())
+		if (mOwner == nullptr || mIndex >= mOwner->mCapacity)
 		{
 			throw std::exception("Cannot increment iterator.");
 		}
 
-		if (++mNodeInChain == mOwner->mBuckets[mIndex].end())
+		// Skip over empty buckets until the next populated one (or the end of the table) is found
+		while (++mIndex < mOwner->mCapacity && mOwner->mBuckets[mIndex].IsEmpty())
 		{
-			// We reached the end of a chain, so search for the next populated bucket
-			while (++mIndex < mOwner->mBuckets.Size() && mOwner->mBuckets[mIndex].IsEmpty())
-			{
-				// Intentionally left blank
-				// Searching for the next populated bucket
-			}
-
-			if (mIndex == mOwner->mBuckets.Size())
-			{
-				// No additional populated buckets were found, set the node to the end of the last bucket
-				mNodeInChain = mOwner->mBuckets[mIndex - 1].end();
-			}
-			else
-			{
-				// Get the beginning of the next populated bucket
-				mNodeInChain = mOwner->mBuckets[mIndex].begin();
-			}
+			// Intentionally left blank
 		}
 
 		return *this;
@@ -84,19 +68,24 @@ namespace Library
 			throw std::exception("Cannot reference a nullptr.");
 		}
 
-		return *mNodeInChain;
+		if (mIndex >= mOwner->mCapacity)
+		{
+			throw std::exception("Cannot dereference the end of the table.");
+		}
+
+		return mOwner->mBuckets[mIndex].Pair();
 	}
 
 	template<typename TKey, typename TData, typename HashFunctor>
 	typename HashMap<TKey, TData, HashFunctor>::PairType* HashMap<TKey, TData, HashFunctor>::Iterator::operator->() const
 	{
-		return &(*mNodeInChain);
+		return &(operator*());
 	}
 
 	template<typename TKey, typename TData, typename HashFunctor>
 	bool HashMap<TKey, TData, HashFunctor>::Iterator::operator==(const Iterator& other) const
 	{
-		return ((mOwner == other.mOwner) && (mNodeInChain == other.mNodeInChain) && (mIndex == other.mIndex));
+		return ((mOwner == other.mOwner) && (mIndex == other.mIndex));
 	}
 
 	template<typename TKey, typename TData, typename HashFunctor>
@@ -110,35 +99,131 @@ namespace Library
 #pragma region HashMap
 
 	template<typename TKey, typename TData, typename HashFunctor>
-	HashMap<TKey, TData, HashFunctor>::HashMap(std::uint32_t sizeOfTable) :
-		mSize(0), mBuckets(BucketType(sizeOfTable, true))
+	const float HashMap<TKey, TData, HashFunctor>::DefaultMaxLoadFactor = 0.875f;
+
+	template<typename TKey, typename TData, typename HashFunctor>
+	HashMap<TKey, TData, HashFunctor>::HashMap(std::uint32_t sizeOfTable, float maxLoadFactor, Allocator& allocator) :
+		mBuckets(nullptr), mCapacity(0), mShift(0), mSize(0), mGrowThreshold(0), mMaxLoadFactor(maxLoadFactor), mAllocator(&allocator)
 	{
 		if (sizeOfTable == 0)
 		{
 			throw std::exception("The size of the table cannot be zero.");
 		}
+
+		if (!(maxLoadFactor > 0.0f && maxLoadFactor <= 1.0f))
+		{
+			throw std::exception("The max load factor must be greater than zero and no more than one.");
+		}
+
+		Allocate(sizeOfTable);
 	}
 
 	template<typename TKey, typename TData, typename HashFunctor>
-	typename HashMap<TKey, TData, HashFunctor>::Iterator HashMap<TKey, TData, HashFunctor>::Find(const TKey& key) const
+	HashMap<TKey, TData, HashFunctor>::HashMap(const HashMap& rhs) :
+		mBuckets(nullptr), mCapacity(0), mShift(0), mSize(0), mGrowThreshold(0), mMaxLoadFactor(rhs.mMaxLoadFactor),
+		mAllocator(&Allocator::Default())
 	{
-		std::uint32_t index = 0;
-		return Find(key, index);
+		Allocate(rhs.mCapacity);
+		operator=(rhs);
 	}
 
 	template<typename TKey, typename TData, typename HashFunctor>
-	typename HashMap<TKey, TData, HashFunctor>::Iterator HashMap<TKey, TData, HashFunctor>::Find(const TKey& key, std::uint32_t& hashIndex) const
+	HashMap<TKey, TData, HashFunctor>::HashMap(HashMap&& rhs) :
+		mBuckets(rhs.mBuckets), mCapacity(rhs.mCapacity), mShift(rhs.mShift), mSize(rhs.mSize),
+		mGrowThreshold(rhs.mGrowThreshold), mMaxLoadFactor(rhs.mMaxLoadFactor), mAllocator(rhs.mAllocator)
+	{
+		rhs.mBuckets = nullptr;
+		rhs.mCapacity = 0;
+		rhs.mShift = 0;
+		rhs.mSize = 0;
+		rhs.mGrowThreshold = 0;
+	}
+
+	template<typename TKey, typename TData, typename HashFunctor>
+	HashMap<TKey, TData, HashFunctor>& HashMap<TKey, TData, HashFunctor>::operator=(const HashMap& rhs)
 	{
-		hashIndex = HashFunctor()(key) % mBuckets.Size();
-		for (auto it = mBuckets[hashIndex].begin(); it != mBuckets[hashIndex].end(); ++it)
+		if (this != &rhs)
 		{
-			if ((*it).first == key)
+			Clear();
+			mMaxLoadFactor = rhs.mMaxLoadFactor;
+
+			if (mCapacity < rhs.mCapacity)
+			{
+				ReleaseBuckets(mBuckets, mCapacity);
+				Allocate(rhs.mCapacity);
+			}
+			else
+			{
+				// Keep the larger bucket array, but honour the max load factor that was copied over
+				mGrowThreshold = static_cast<std::uint32_t>(mCapacity * mMaxLoadFactor);
+			}
+
+			for (std::uint32_t i = 0; i < rhs.mCapacity; ++i)
 			{
-				return Iterator(this, it, hashIndex);
+				const Bucket& bucket = rhs.mBuckets[i];
+				if (!bucket.IsEmpty())
+				{
+					InsertNew(PairType(bucket.Pair()), bucket.mHash);
+				}
 			}
 		}
 
-		return end();
+		return *this;
+	}
+
+	template<typename TKey, typename TData, typename HashFunctor>
+	HashMap<TKey, TData, HashFunctor>& HashMap<TKey, TData, HashFunctor>::operator=(HashMap&& rhs)
+	{
+		if (this != &rhs)
+		{
+			DestroyAll();
+			ReleaseBuckets(mBuckets, mCapacity);
+
+			mBuckets = rhs.mBuckets;
+			mCapacity = rhs.mCapacity;
+			mShift = rhs.mShift;
+			mSize = rhs.mSize;
+			mGrowThreshold = rhs.mGrowThreshold;
+			mMaxLoadFactor = rhs.mMaxLoadFactor;
+			mAllocator = rhs.mAllocator;
+
+			rhs.mBuckets = nullptr;
+			rhs.mCapacity = 0;
+			rhs.mShift = 0;
+			rhs.mSize = 0;
+			rhs.mGrowThreshold = 0;
+		}
+
+		return *this;
+	}
+
+	template<typename TKey, typename TData, typename HashFunctor>
+	HashMap<TKey, TData, HashFunctor>::~HashMap()
+	{
+		DestroyAll();
+		ReleaseBuckets(mBuckets, mCapacity);
+	}
+
+	template<typename TKey, typename TData, typename HashFunctor>
+	typename HashMap<TKey, TData, HashFunctor>::Iterator HashMap<TKey, TData, HashFunctor>::Find(const TKey& key) const
+	{
+		std::uint32_t index = 0;
+		return Find(key, index);
+	}
+
+	template<typename TKey, typename TData, typename HashFunctor>
+	typename HashMap<TKey, TData, HashFunctor>::Iterator HashMap<TKey, TData, HashFunctor>::Find(const TKey& key, std::uint32_t& hashIndex) const
+	{
+		const std::uint32_t hash = HashFunctor()(key);
+		hashIndex = HomeIndex(hash);
+		return Iterator(this, FindIndex(key, hash));
+	}
+
+	template<typename TKey, typename TData, typename HashFunctor>
+	template<typename TLookup, typename>
+	typename HashMap<TKey, TData, HashFunctor>::Iterator HashMap<TKey, TData, HashFunctor>::Find(const TLookup& key) const
+	{
+		return Iterator(this, FindIndex(key, HashFunctor()(key)));
 	}
 
 	template<typename TKey, typename TData, typename HashFunctor>
@@ -152,17 +237,22 @@ namespace Library
 	typename HashMap<TKey, TData, HashFunctor>::Iterator HashMap<TKey, TData, HashFunctor>::Insert(const PairType& entry, bool& wasInserted)
 	{
 		wasInserted = false;
-		std::uint32_t index = 0;
-		Iterator foundIter = Find(entry.first, index);
-		if (foundIter == end())
+		const std::uint32_t hash = HashFunctor()(entry.first);
+		std::uint32_t index = FindIndex(entry.first, hash);
+		if (index == mCapacity)
 		{
 			// The key wasn't found, create a new entry
-			auto chainIter = mBuckets[index].PushBack(PairType(entry.first, entry.second));
-			foundIter = Iterator(this, chainIter, index);
-			++mSize;
+			// Doubling keeps the cost of rehashing amortized constant per insert
+			while (mSize >= mGrowThreshold)
+			{
+				Rebuild(mCapacity * 2);
+			}
+
+			index = InsertNew(PairType(entry), hash);
 			wasInserted = true;
 		}
-		return foundIter;
+
+		return Iterator(this, index);
 	}
 
 	template<typename TKey, typename TData, typename HashFunctor>
@@ -175,22 +265,40 @@ namespace Library
 	template<typename TKey, typename TData, typename HashFunctor>
 	void HashMap<TKey, TData, HashFunctor>::Remove(const TKey& key)
 	{
-		Iterator it = Find(key);
-		if (it != end())
+		std::uint32_t index = FindIndex(key, HashFunctor()(key));
+		if (index == mCapacity)
 		{
-			mBuckets[it.mIndex].Remove(*it);
-			--mSize;
+			return;
+		}
+
+		mBuckets[index].Pair().~PairType();
+		mBuckets[index].mProbeLength = 0;
+		--mSize;
+
+		// Backward-shift the following run so that no tombstones are needed
+		const std::uint32_t mask = mCapacity - 1;
+		std::uint32_t next = (index + 1) & mask;
+		while (mBuckets[next].mProbeLength > 1)
+		{
+			Bucket& hole = mBuckets[index];
+			Bucket& shifted = mBuckets[next];
+
+			new(&hole.mStorage)PairType(std::move(shifted.Pair()));
+			hole.mHash = shifted.mHash;
+			hole.mProbeLength = shifted.mProbeLength - 1;
+
+			shifted.Pair().~PairType();
+			shifted.mProbeLength = 0;
+
+			index = next;
+			next = (next + 1) & mask;
 		}
 	}
 
 	template<typename TKey, typename TData, typename HashFunctor>
 	void HashMap<TKey, TData, HashFunctor>::Clear()
 	{
-		for (std::uint32_t i = 0; i < mBuckets.Size(); ++i)
-		{
-			mBuckets[i].Clear();
-		}
-		mSize = 0;
+		DestroyAll();
 	}
 
 	template<typename TKey, typename TData, typename HashFunctor>
@@ -199,6 +307,56 @@ namespace Library
 		return mSize;
 	}
 
+	template<typename TKey, typename TData, typename HashFunctor>
+	std::uint32_t HashMap<TKey, TData, HashFunctor>::Capacity() const
+	{
+		return mCapacity;
+	}
+
+	template<typename TKey, typename TData, typename HashFunctor>
+	float HashMap<TKey, TData, HashFunctor>::LoadFactor() const
+	{
+		return (mCapacity == 0 ? 0.0f : static_cast<float>(mSize) / mCapacity);
+	}
+
+	template<typename TKey, typename TData, typename HashFunctor>
+	float HashMap<TKey, TData, HashFunctor>::MaxLoadFactor() const
+	{
+		return mMaxLoadFactor;
+	}
+
+	template<typename TKey, typename TData, typename HashFunctor>
+	void HashMap<TKey, TData, HashFunctor>::SetMaxLoadFactor(float maxLoadFactor)
+	{
+		if (!(maxLoadFactor > 0.0f && maxLoadFactor <= 1.0f))
+		{
+			throw std::exception("The max load factor must be greater than zero and no more than one.");
+		}
+
+		mMaxLoadFactor = maxLoadFactor;
+		mGrowThreshold = static_cast<std::uint32_t>(mCapacity * mMaxLoadFactor);
+		if (mSize > mGrowThreshold)
+		{
+			Rebuild(BucketsNeededFor(mSize));
+		}
+	}
+
+	template<typename TKey, typename TData, typename HashFunctor>
+	void HashMap<TKey, TData, HashFunctor>::Reserve(std::uint32_t size)
+	{
+		if (size > mGrowThreshold)
+		{
+			Rebuild(BucketsNeededFor(size));
+		}
+	}
+
+	template<typename TKey, typename TData, typename HashFunctor>
+	void HashMap<TKey, TData, HashFunctor>::Rehash(std::uint32_t sizeOfTable)
+	{
+		const std::uint32_t neededBuckets = BucketsNeededFor(mSize);
+		Rebuild(sizeOfTable > neededBuckets ? sizeOfTable : neededBuckets);
+	}
+
 	template<typename TKey, typename TData, typename HashFunctor>
 	bool HashMap<TKey, TData, HashFunctor>::ContainsKey(const TKey& key) const
 	{
@@ -208,11 +366,11 @@ namespace Library
 	template<typename TKey, typename TData, typename HashFunctor>
 	typename HashMap<TKey, TData, HashFunctor>::Iterator HashMap<TKey, TData, HashFunctor>::begin() const
 	{
-		for (std::uint32_t i = 0; i < mBuckets.Size(); ++i)
+		for (std::uint32_t i = 0; i < mCapacity; ++i)
 		{
 			if (!mBuckets[i].IsEmpty())
 			{
-				return Iterator(this, mBuckets[i].begin(), i);
+				return Iterator(this, i);
 			}
 		}
 
@@ -222,9 +380,183 @@ namespace Library
 	template<typename TKey, typename TData, typename HashFunctor>
 	typename HashMap<TKey, TData, HashFunctor>::Iterator HashMap<TKey, TData, HashFunctor>::end() const
 	{
-		return Iterator(this, mBuckets[mBuckets.Size() - 1].end(), mBuckets.Size());
+		return Iterator(this, mCapacity);
+	}
+
+	template<typename TKey, typename TData, typename HashFunctor>
+	inline std::uint32_t HashMap<TKey, TData, HashFunctor>::HomeIndex(const std::uint32_t hash) const
+	{
+		// Fibonacci hashing scrambles the high bits into the index, so weak hashes still spread out
+		return static_cast<std::uint32_t>((hash * 2654435769U) >> mShift);
+	}
+
+	template<typename TKey, typename TData, typename HashFunctor>
+	template<typename TLookup>
+	std::uint32_t HashMap<TKey, TData, HashFunctor>::FindIndex(const TLookup& key, const std::uint32_t hash) const
+	{
+		if (mCapacity == 0)
+		{
+			// The table was moved from
+			return mCapacity;
+		}
+
+		const std::uint32_t mask = mCapacity - 1;
+		std::uint32_t index = HomeIndex(hash);
+		std::uint32_t probeLength = 1;
+
+		// A Robin Hood table can stop as soon as it reaches a bucket that is closer to home than we are
+		while (mBuckets[index].mProbeLength >= probeLength)
+		{
+			const Bucket& bucket = mBuckets[index];
+			if ((bucket.mHash == hash) && (bucket.Pair().first == key))
+			{
+				return index;
+			}
+
+			index = (index + 1) & mask;
+			++probeLength;
+		}
+
+		return mCapacity;
+	}
+
+	template<typename TKey, typename TData, typename HashFunctor>
+	std::uint32_t HashMap<TKey, TData, HashFunctor>::InsertNew(PairType&& entry, const std::uint32_t hash)
+	{
+		const std::uint32_t mask = mCapacity - 1;
+		std::uint32_t index = HomeIndex(hash);
+		std::uint32_t probeLength = 1;
+		std::uint32_t carriedHash = hash;
+		std::uint32_t insertedIndex = mCapacity;
+
+		// The entry being carried down the probe sequence. It starts as the new entry and
+		// becomes whichever entry was displaced by the last swap.
+		typename std::aligned_storage<sizeof(PairType), alignof(PairType)>::type carriedStorage;
+		PairType* carried = new(&carriedStorage)PairType(std::move(entry));
+
+		while (true)
+		{
+			Bucket& bucket = mBuckets[index];
+			if (bucket.IsEmpty())
+			{
+				new(&bucket.mStorage)PairType(std::move(*carried));
+				bucket.mHash = carriedHash;
+				bucket.mProbeLength = probeLength;
+				carried->~PairType();
+
+				if (insertedIndex == mCapacity)
+				{
+					insertedIndex = index;
+				}
+				break;
+			}
+
+			if (bucket.mProbeLength < probeLength)
+			{
+				// Take from the rich: the resident is closer to home than we are, so swap places
+				PairType displaced(std::move(bucket.Pair()));
+				bucket.Pair().~PairType();
+				new(&bucket.mStorage)PairType(std::move(*carried));
+				carried->~PairType();
+				carried = new(&carriedStorage)PairType(std::move(displaced));
+
+				std::swap(bucket.mHash, carriedHash);
+				std::swap(bucket.mProbeLength, probeLength);
+
+				if (insertedIndex == mCapacity)
+				{
+					insertedIndex = index;
+				}
+			}
+
+			index = (index + 1) & mask;
+			++probeLength;
+		}
+
+		++mSize;
+		return insertedIndex;
+	}
+
+	template<typename TKey, typename TData, typename HashFunctor>
+	void HashMap<TKey, TData, HashFunctor>::Allocate(const std::uint32_t capacity)
+	{
+		std::uint32_t shift = 32;
+		std::uint32_t roundedCapacity = 1;
+		while (roundedCapacity < capacity || roundedCapacity < MinimumCapacity)
+		{
+			roundedCapacity <<= 1;
+			--shift;
+		}
+
+		mBuckets = static_cast<Bucket*>(mAllocator->Allocate(sizeof(Bucket) * roundedCapacity));
+		for (std::uint32_t i = 0; i < roundedCapacity; ++i)
+		{
+			new(mBuckets + i)Bucket();
+		}
+
+		mCapacity = roundedCapacity;
+		mShift = shift;
+		mGrowThreshold = static_cast<std::uint32_t>(mCapacity * mMaxLoadFactor);
+	}
+
+	template<typename TKey, typename TData, typename HashFunctor>
+	void HashMap<TKey, TData, HashFunctor>::Rebuild(const std::uint32_t capacity)
+	{
+		Bucket* oldBuckets = mBuckets;
+		const std::uint32_t oldCapacity = mCapacity;
+
+		Allocate(capacity);
+		mSize = 0;
+
+		for (std::uint32_t i = 0; i < oldCapacity; ++i)
+		{
+			Bucket& bucket = oldBuckets[i];
+			if (!bucket.IsEmpty())
+			{
+				InsertNew(std::move(bucket.Pair()), bucket.mHash);
+				bucket.Pair().~PairType();
+			}
+		}
+
+		ReleaseBuckets(oldBuckets, oldCapacity);
+	}
+
+	template<typename TKey, typename TData, typename HashFunctor>
+	void HashMap<TKey, TData, HashFunctor>::ReleaseBuckets(Bucket* buckets, const std::uint32_t capacity)
+	{
+		// Buckets are trivially destructible, their pairs have already been destroyed
+		mAllocator->Deallocate(buckets, sizeof(Bucket) * capacity);
+	}
+
+	template<typename TKey, typename TData, typename HashFunctor>
+	std::uint32_t HashMap<TKey, TData, HashFunctor>::BucketsNeededFor(const std::uint32_t size) const
+	{
+		// Smallest bucket count that keeps the given number of entries at or under the max load factor
+		std::uint32_t buckets = static_cast<std::uint32_t>(size / mMaxLoadFactor);
+		while (static_cast<std::uint32_t>(buckets * mMaxLoadFactor) < size)
+		{
+			++buckets;
+		}
+
+		return buckets;
+	}
+
+	template<typename TKey, typename TData, typename HashFunctor>
+	void HashMap<TKey, TData, HashFunctor>::DestroyAll()
+	{
+		for (std::uint32_t i = 0; i < mCapacity; ++i)
+		{
+			Bucket& bucket = mBuckets[i];
+			if (!bucket.IsEmpty())
+			{
+				bucket.Pair().~PairType();
+				bucket.mProbeLength = 0;
+			}
+		}
+
+		mSize = 0;
 	}
 
 #pragma endregion
 
-}
\ No newline at end of file
+}
@@ -0,0 +1,31 @@
+#pragma once
+
+namespace Library
+{
+	class EventPublisher;
+
+	/**
+	 * An IEventPool owns reusable events. An EventQueue hands each pooled event back to its pool
+	 * once the event has been delivered, so it can be acquired and fired again.
+	 */
+	class IEventPool
+	{
+	public:
+		/**
+		 * Default constructor.
+		 */
+		IEventPool() = default;
+
+		/**
+		 * Default deconstructor.
+		 */
+		virtual ~IEventPool() = default;
+
+		/**
+		 * Takes back an event that has finished being delivered.
+		 *
+		 * @param publisher the event, which must have been acquired from this pool
+		 */
+		virtual void Release(EventPublisher& publisher) = 0;
+	};
+}
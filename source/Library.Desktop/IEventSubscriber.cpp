@@ -0,0 +1,14 @@
+#include "pch.h"
+
+namespace Library
+{
+
+	void IEventSubscriber::NotifyBatch(const Span<const EventPublisher* const> publishers)
+	{
+		for (const EventPublisher* publisher : publishers)
+		{
+			Notify(*publisher);
+		}
+	}
+
+}
@@ -1,5 +1,7 @@
 #pragma once
 
+#include "Span.h"
+
 namespace Library
 {
 	class EventPublisher;
@@ -28,5 +30,15 @@ namespace Library
 		 * @param publisher the address of the EventPublisher that sent the message
 		 */
 		virtual void Notify(const EventPublisher& publisher) = 0;
+
+		/**
+		 * Handles a batch of events of one type, in the order they expired. Called by an EventQueue
+		 * that delivers in batches, once per subscriber for each type of event that expired in an
+		 * Update. By default each event is passed to Notify in turn; a subscriber that can handle
+		 * the whole batch at once overrides this.
+		 *
+		 * @param publishers the addresses of the EventPublishers that sent the messages
+		 */
+		virtual void NotifyBatch(const Span<const EventPublisher* const> publishers);
 	};
 }
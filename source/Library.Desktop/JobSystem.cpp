@@ -0,0 +1,201 @@
+#include "pch.h"
+
+namespace Library
+{
+	thread_local const JobSystem* JobSystem::sCurrentJobSystem = nullptr;
+	thread_local std::uint32_t JobSystem::sWorkerIndex = JobSystem::NoWorker;
+
+	JobSystem::JobSystem(const std::uint32_t workerCount) :
+		mWorkerCount(workerCount), mWorkers(new Worker[workerCount]), mThreads(), mQueuedTasks(0), mSleepMutex(), mWakeUp(), mIsStopping(false)
+	{
+		mThreads.reserve(workerCount);
+		for (std::uint32_t i = 0; i < workerCount; ++i)
+		{
+			mThreads.emplace_back(&JobSystem::WorkerLoop, this, i);
+		}
+	}
+
+	JobSystem::~JobSystem()
+	{
+		{
+			std::lock_guard<std::mutex> lock(mSleepMutex);
+			mIsStopping = true;
+		}
+		mWakeUp.notify_all();
+
+		for (auto& thread : mThreads)
+		{
+			thread.join();
+		}
+
+		delete[] mWorkers;
+	}
+
+	void JobSystem::ParallelFor(const std::uint32_t count, const std::uint32_t grainSize, const RangeJob& job)
+	{
+		if (grainSize == 0)
+		{
+			throw std::exception("The grain size must be greater than zero.");
+		}
+
+		// Loops that fit in one chunk are not worth handing to another thread
+		if (mWorkerCount == 0 || count <= grainSize)
+		{
+			if (count > 0)
+			{
+				job(0, count);
+			}
+			return;
+		}
+
+		const std::uint32_t chunkCount = (count + grainSize - 1) / grainSize;
+		Batch batch;
+		batch.mJob = &job;
+		batch.mRemaining = chunkCount;
+
+		// Deal the chunks out across the deques so that the workers start on their own work
+		const std::uint32_t caller = (sCurrentJobSystem == this ? sWorkerIndex : NoWorker);
+		for (std::uint32_t chunk = 0; chunk < chunkCount; ++chunk)
+		{
+			const std::uint32_t begin = chunk * grainSize;
+			const std::uint32_t end = (count - begin > grainSize ? begin + grainSize : count);
+			Push((caller != NoWorker ? caller + chunk : chunk) % mWorkerCount, Task{ &batch, begin, end });
+		}
+
+		{
+			std::lock_guard<std::mutex> lock(mSleepMutex);
+		}
+		mWakeUp.notify_all();
+
+		// Help out while there are chunks to take, which keeps nested loops from running out of threads
+		Task task;
+		while (batch.mRemaining.load(std::memory_order_acquire) > 0 && Acquire(caller, task))
+		{
+			Run(task);
+		}
+
+		// The rest of the chunks are running on other threads, so wait for them without spinning
+		{
+			std::unique_lock<std::mutex> lock(batch.mMutex);
+			batch.mDone.wait(lock, [&batch] { return (batch.mRemaining.load(std::memory_order_relaxed) == 0); });
+		}
+
+		if (batch.mException != nullptr)
+		{
+			std::rethrow_exception(batch.mException);
+		}
+	}
+
+	std::uint32_t JobSystem::WorkerCount() const
+	{
+		return mWorkerCount;
+	}
+
+	std::uint32_t JobSystem::DefaultWorkerCount()
+	{
+		const std::uint32_t hardwareThreads = std::thread::hardware_concurrency();
+		return (hardwareThreads > 1 ? hardwareThreads - 1 : 0);
+	}
+
+	JobSystem& JobSystem::Shared()
+	{
+		static JobSystem sharedJobSystem;
+		return sharedJobSystem;
+	}
+
+	void JobSystem::WorkerLoop(const std::uint32_t index)
+	{
+		sCurrentJobSystem = this;
+		sWorkerIndex = index;
+
+		for (;;)
+		{
+			Task task;
+			if (Acquire(index, task))
+			{
+				Run(task);
+				continue;
+			}
+
+			std::unique_lock<std::mutex> lock(mSleepMutex);
+			mWakeUp.wait(lock, [this] { return (mIsStopping || mQueuedTasks.load() > 0); });
+			if (mIsStopping && mQueuedTasks.load() == 0)
+			{
+				return;
+			}
+		}
+	}
+
+	void JobSystem::Push(const std::uint32_t index, const Task& task)
+	{
+		std::lock_guard<std::mutex> lock(mWorkers[index].mMutex);
+		mWorkers[index].mTasks.push_back(task);
+		++mQueuedTasks;
+	}
+
+	bool JobSystem::Pop(const std::uint32_t index, Task& task)
+	{
+		Worker& worker = mWorkers[index];
+		std::lock_guard<std::mutex> lock(worker.mMutex);
+		if (worker.mTasks.empty())
+		{
+			return false;
+		}
+
+		// The owner works from the back, where the most recently queued chunk is still warm
+		task = worker.mTasks.back();
+		worker.mTasks.pop_back();
+		--mQueuedTasks;
+		return true;
+	}
+
+	bool JobSystem::Steal(const std::uint32_t thief, Task& task)
+	{
+		const std::uint32_t start = (thief != NoWorker ? thief + 1 : 0);
+		for (std::uint32_t i = 0; i < mWorkerCount; ++i)
+		{
+			Worker& victim = mWorkers[(start + i) % mWorkerCount];
+			std::lock_guard<std::mutex> lock(victim.mMutex);
+			if (!victim.mTasks.empty())
+			{
+				// Thieves take from the front, away from where the owner is working
+				task = victim.mTasks.front();
+				victim.mTasks.pop_front();
+				--mQueuedTasks;
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	bool JobSystem::Acquire(const std::uint32_t index, Task& task)
+	{
+		return ((index != NoWorker && Pop(index, task)) || Steal(index, task));
+	}
+
+	void JobSystem::Run(const Task& task)
+	{
+		Batch& batch = *task.mBatch;
+		try
+		{
+			(*batch.mJob)(task.mBegin, task.mEnd);
+		}
+		catch (...)
+		{
+			std::lock_guard<std::mutex> lock(batch.mMutex);
+			if (batch.mException == nullptr)
+			{
+				batch.mException = std::current_exception();
+			}
+		}
+
+		// The batch lives on the caller's stack, so it must not be touched after this. The count only drops under the
+		// lock, so the caller cannot see it reach zero, return and destroy the batch before the signal has been sent.
+		std::lock_guard<std::mutex> lock(batch.mMutex);
+		if (batch.mRemaining.fetch_sub(1, std::memory_order_acq_rel) == 1)
+		{
+			batch.mDone.notify_all();
+		}
+	}
+}
@@ -0,0 +1,125 @@
+#pragma once
+
+#include <cstdint>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Library
+{
+	/**
+	 * @brief A fixed set of worker threads that split loops into chunks and steal work from each other.
+	 *
+	 * Each worker owns a deque of chunks. A worker takes chunks from the back of its own deque
+	 * and, once that is empty, steals from the front of the other workers' deques, so uneven
+	 * chunks even out without a shared queue. The thread that starts a loop helps run queued
+	 * chunks, which also lets jobs start nested loops, and once none are left to take it sleeps
+	 * until the chunks still running on other threads are done. The workers sleep while there is
+	 * nothing to do and are joined when the JobSystem is destroyed.
+	 */
+	class JobSystem final
+	{
+	public:
+		/**
+		 * The body of a parallel loop. It is called with a half-open range [begin, end) of indices.
+		 */
+		typedef std::function<void(std::uint32_t, std::uint32_t)> RangeJob;
+
+		/**
+		 * Constructs a JobSystem and starts its workers.
+		 *
+		 * @param workerCount the number of worker threads; with none, loops run on the calling thread
+		 */
+		explicit JobSystem(const std::uint32_t workerCount = DefaultWorkerCount());
+
+		// The workers refer back to the JobSystem, so it cannot be copied or moved
+		JobSystem(const JobSystem& rhs) = delete;
+		JobSystem& operator=(const JobSystem& rhs) = delete;
+
+		/**
+		 * Destructor. Waits for the queued chunks to finish and joins the workers.
+		 */
+		~JobSystem();
+
+		/**
+		 * Runs a job over [0, count) in chunks of at most grainSize indices and waits for every
+		 * chunk to finish. If any chunk throws, the first exception is rethrown once the rest
+		 * have finished.
+		 *
+		 * @param count the number of indices
+		 * @param grainSize the largest number of indices handed to the job at once
+		 * @param job the job to run
+		 */
+		void ParallelFor(const std::uint32_t count, const std::uint32_t grainSize, const RangeJob& job);
+
+		/**
+		 * Returns the number of worker threads.
+		 *
+		 * @return the number of worker threads
+		 */
+		std::uint32_t WorkerCount() const;
+
+		/**
+		 * Returns one worker for each hardware thread, less the one that starts the loops.
+		 *
+		 * @return the default number of worker threads
+		 */
+		static std::uint32_t DefaultWorkerCount();
+
+		/**
+		 * Returns the JobSystem shared by the whole program, such as for delivering events. It is
+		 * started on first use with the default number of workers and joined at exit.
+		 *
+		 * @return a reference to the shared JobSystem
+		 */
+		static JobSystem& Shared();
+
+	private:
+		struct Batch
+		{
+			const RangeJob* mJob;						/**< The job the chunks belong to */
+			std::atomic<std::uint32_t> mRemaining;		/**< The number of chunks still to finish, only lowered under mMutex */
+			std::mutex mMutex;							/**< Guards mException and the count of chunks finishing */
+			std::condition_variable mDone;				/**< Signalled when the last chunk finishes */
+			std::exception_ptr mException;				/**< The first exception thrown by a chunk */
+		};
+
+		struct Task
+		{
+			Batch* mBatch;					/**< The loop the chunk belongs to */
+			std::uint32_t mBegin;			/**< The first index of the chunk */
+			std::uint32_t mEnd;				/**< One past the last index of the chunk */
+		};
+
+		struct Worker
+		{
+			std::mutex mMutex;				/**< Guards mTasks */
+			std::deque<Task> mTasks;		/**< The chunks queued on the worker */
+		};
+
+		void WorkerLoop(const std::uint32_t index);
+		void Push(const std::uint32_t index, const Task& task);
+		bool Pop(const std::uint32_t index, Task& task);
+		bool Steal(const std::uint32_t thief, Task& task);
+		bool Acquire(const std::uint32_t index, Task& task);
+		static void Run(const Task& task);
+
+		std::uint32_t mWorkerCount;					/**< The number of worker threads */
+		Worker* mWorkers;							/**< The deque of each worker */
+		std::vector<std::thread> mThreads;			/**< The worker threads */
+		std::atomic<std::uint32_t> mQueuedTasks;	/**< The number of chunks waiting in the deques */
+		std::mutex mSleepMutex;						/**< Guards the wake-up condition */
+		std::condition_variable mWakeUp;			/**< Signalled when chunks are queued or the workers stop */
+		bool mIsStopping;							/**< Set when the workers should exit */
+
+		static const std::uint32_t NoWorker = UINT32_MAX;
+
+		static thread_local const JobSystem* sCurrentJobSystem;		/**< The JobSystem that owns this thread, if any */
+		static thread_local std::uint32_t sWorkerIndex;				/**< The index of the worker running on this thread */
+	};
+}
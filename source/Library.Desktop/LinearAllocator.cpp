@@ -0,0 +1,134 @@
+#include "pch.h"
+
+namespace Library
+{
+	LinearAllocator::LinearAllocator(const std::size_t pageSize, Allocator& backingAllocator) :
+		mBackingAllocator(&backingAllocator), mPageSize(AlignUp(pageSize)), mPageCount(0), mPages(nullptr),
+		mCursor(nullptr), mEnd(nullptr), mLastBlock(nullptr)
+	{
+		if (mPageSize == 0)
+		{
+			throw std::exception("The page size of a LinearAllocator cannot be zero.");
+		}
+	}
+
+	LinearAllocator::~LinearAllocator()
+	{
+		while (mPages != nullptr)
+		{
+			Page* next = mPages->mNext;
+			ReleasePage(mPages);
+			mPages = next;
+		}
+	}
+
+	void LinearAllocator::Reset()
+	{
+		// Keep one regular page around so that the next frame or level starts without allocating
+		Page* keptPage = nullptr;
+		while (mPages != nullptr)
+		{
+			Page* next = mPages->mNext;
+			if (keptPage == nullptr && mPages->mSize == mPageSize)
+			{
+				keptPage = mPages;
+				keptPage->mNext = nullptr;
+			}
+			else
+			{
+				ReleasePage(mPages);
+			}
+			mPages = next;
+		}
+
+		mPages = keptPage;
+		mPageCount = (keptPage != nullptr ? 1 : 0);
+		mCursor = (keptPage != nullptr ? reinterpret_cast<char*>(keptPage) + AlignUp(sizeof(Page)) : nullptr);
+		mEnd = (keptPage != nullptr ? mCursor + mPageSize : nullptr);
+		mLastBlock = nullptr;
+		ResetBytesInUse();
+	}
+
+	std::uint32_t LinearAllocator::PageCount() const
+	{
+		return mPageCount;
+	}
+
+	void* LinearAllocator::DoAllocate(const std::size_t size)
+	{
+		const std::size_t alignedSize = AlignUp(size);
+
+		if (alignedSize > mPageSize)
+		{
+			// Oversized blocks get a page of their own, slotted in behind the newest page so it stays current
+			Page* newestPage = mPages;
+			Page* page = AddPage(alignedSize);
+			if (newestPage != nullptr)
+			{
+				page->mNext = newestPage->mNext;
+				newestPage->mNext = page;
+				mPages = newestPage;
+			}
+
+			mLastBlock = nullptr;
+			return reinterpret_cast<char*>(page) + AlignUp(sizeof(Page));
+		}
+
+		if (static_cast<std::size_t>(mEnd - mCursor) < alignedSize)
+		{
+			mCursor = reinterpret_cast<char*>(AddPage(mPageSize)) + AlignUp(sizeof(Page));
+			mEnd = mCursor + mPageSize;
+		}
+
+		mLastBlock = mCursor;
+		mCursor += alignedSize;
+		return mLastBlock;
+	}
+
+	void* LinearAllocator::DoReallocate(void* memory, const std::size_t oldSize, const std::size_t newSize)
+	{
+		if (memory == mLastBlock && static_cast<std::size_t>(mEnd - mLastBlock) >= AlignUp(newSize))
+		{
+			// The most recent block can grow or shrink without moving
+			mCursor = mLastBlock + AlignUp(newSize);
+			return memory;
+		}
+
+		return Allocator::DoReallocate(memory, oldSize, newSize);
+	}
+
+	void LinearAllocator::DoDeallocate(void* memory, const std::size_t size)
+	{
+		UNREFERENCED_PARAMETER(size);
+
+		// Only the most recent block can be given back, everything else waits for Reset()
+		if (memory == mLastBlock)
+		{
+			mCursor = mLastBlock;
+			mLastBlock = nullptr;
+		}
+	}
+
+	std::size_t LinearAllocator::AlignUp(const std::size_t size)
+	{
+		const std::size_t alignment = alignof(std::max_align_t);
+		return (size + alignment - 1) & ~(alignment - 1);
+	}
+
+	LinearAllocator::Page* LinearAllocator::AddPage(const std::size_t size)
+	{
+		// The header is padded so the blocks that follow it stay aligned
+		Page* page = static_cast<Page*>(mBackingAllocator->Allocate(AlignUp(sizeof(Page)) + size));
+		page->mNext = mPages;
+		page->mSize = size;
+		mPages = page;
+		++mPageCount;
+
+		return page;
+	}
+
+	void LinearAllocator::ReleasePage(Page* page)
+	{
+		mBackingAllocator->Deallocate(page, AlignUp(sizeof(Page)) + page->mSize);
+	}
+}
@@ -0,0 +1,72 @@
+#pragma once
+
+#include "Allocator.h"
+
+namespace Library
+{
+	/**
+	 * @brief An Allocator that hands out memory by bumping a pointer through large pages.
+	 *
+	 * Allocating is a pointer bump and individual blocks are not given back, apart from the
+	 * most recent one, which can be freed or resized in place. Everything is released at once
+	 * with Reset(), which makes a LinearAllocator a good home for per-frame or per-level data:
+	 * the cost of the teardown depends on the number of pages, not the number of objects.
+	 * Destructors are not run by Reset(), so containers using the Allocator must be destroyed
+	 * or abandoned first. A LinearAllocator is not thread-safe.
+	 */
+	class LinearAllocator final : public Allocator
+	{
+	public:
+		/**
+		 * Constructs a LinearAllocator. No memory is taken until the first allocation.
+		 *
+		 * @param pageSize the number of bytes in each page; larger blocks get a page of their own
+		 * @param backingAllocator the Allocator the pages come from
+		 */
+		explicit LinearAllocator(const std::size_t pageSize = DefaultPageSize, Allocator& backingAllocator = Allocator::Default());
+
+		/**
+		 * Deconstructor. Returns every page to the backing Allocator.
+		 */
+		virtual ~LinearAllocator();
+
+		/**
+		 * Releases every block handed out so far. The first page is kept for reuse and the
+		 * rest are returned to the backing Allocator.
+		 */
+		void Reset();
+
+		/**
+		 * Returns the number of pages taken from the backing Allocator.
+		 *
+		 * @return the number of pages
+		 */
+		std::uint32_t PageCount() const;
+
+		static const std::size_t DefaultPageSize = 64 * 1024;		/**< The size of a page when none is given */
+
+	protected:
+		virtual void* DoAllocate(const std::size_t size) override;
+		virtual void* DoReallocate(void* memory, const std::size_t oldSize, const std::size_t newSize) override;
+		virtual void DoDeallocate(void* memory, const std::size_t size) override;
+
+	private:
+		struct Page
+		{
+			Page* mNext;					/**< The page allocated before this one */
+			std::size_t mSize;				/**< The number of usable bytes in the page */
+		};
+
+		static std::size_t AlignUp(const std::size_t size);
+		Page* AddPage(const std::size_t size);
+		void ReleasePage(Page* page);
+
+		Allocator* mBackingAllocator;		/**< Where the pages come from */
+		std::size_t mPageSize;				/**< The usable size of a regular page */
+		std::uint32_t mPageCount;			/**< The number of pages held */
+		Page* mPages;						/**< The newest page */
+		char* mCursor;						/**< The next free byte in the newest page */
+		char* mEnd;							/**< One past the last byte of the newest page */
+		char* mLastBlock;					/**< The most recent block, which can be freed or resized in place */
+	};
+}
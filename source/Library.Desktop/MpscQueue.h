@@ -0,0 +1,83 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <atomic>
+
+namespace Library
+{
+	/**
+	 * A lock-free first-in, first-out queue that any number of threads can push onto while one
+	 * thread at a time pops. Pushing is a single atomic exchange, so producers never wait on
+	 * each other or on the consumer. Each item lives in its own node, which is linked behind the
+	 * previous one once the exchange has claimed its place; until that link is stored, the
+	 * consumer stops at the gap and finds the rest on a later TryPop.
+	 *
+	 * Popped nodes are recycled rather than freed. The consumer puts them in a fixed-size ring
+	 * that producers take them back out of, so a queue in steady use does not go to the heap
+	 * on every push. The ring hands each node to one producer at a time without locking, and
+	 * only when it is empty or full does the queue allocate or free a node.
+	 *
+	 * Based on Dmitry Vyukov's non-intrusive MPSC node-based queue, with his bounded MPMC
+	 * queue as the ring of free nodes.
+	 */
+	template<typename T>
+	class MpscQueue final
+	{
+	public:
+		/**
+		 * Default constructor.
+		 */
+		MpscQueue();
+
+		// Producers hold on to the nodes while they link them in, so the queue cannot be copied or moved
+		MpscQueue(const MpscQueue& rhs) = delete;
+		MpscQueue& operator=(const MpscQueue& rhs) = delete;
+
+		/**
+		 * Destructor. Frees any items that were never popped, and the free nodes.
+		 */
+		~MpscQueue();
+
+		/**
+		 * Adds an item to the back of the queue. Safe to call from any thread.
+		 *
+		 * @param item the item to add
+		 */
+		void Push(const T& item);
+
+		/**
+		 * Removes the item at the front of the queue, if there is one. Only one thread may pop at a time.
+		 *
+		 * @param item set to the removed item
+		 * @return true if an item was removed, false if the queue was empty
+		 */
+		bool TryPop(T& item);
+
+	private:
+		struct Node
+		{
+			std::atomic<Node*> mNext;		/**< The node pushed after this one */
+			T mItem;						/**< The item */
+		};
+
+		struct FreeCell
+		{
+			std::atomic<std::size_t> mSequence;		/**< Which pass over the ring the cell is ready for */
+			Node* mNode;							/**< The free node, while the cell holds one */
+		};
+
+		Node* AcquireNode(const T& item);
+		void RecycleNode(Node* node);
+
+		static const std::size_t FreeNodeCapacity = 256;
+
+		std::atomic<Node*> mHead;					/**< The node pushed last, which producers link behind */
+		Node* mTail;								/**< The node whose item was popped last, owned by the consumer */
+		FreeCell* mFreeNodes;						/**< The ring of popped nodes waiting to be reused */
+		std::atomic<std::size_t> mFreeTakePosition;	/**< Where producers take the next free node from */
+		std::size_t mFreePutPosition;				/**< Where the consumer puts the next free node, owned by the consumer */
+	};
+}
+
+#include "MpscQueue.inl"
@@ -0,0 +1,116 @@
+#include "pch.h"
+
+namespace Library
+{
+	template<typename T>
+	MpscQueue<T>::MpscQueue() :
+		mHead(nullptr), mTail(nullptr), mFreeNodes(new FreeCell[FreeNodeCapacity]), mFreeTakePosition(0), mFreePutPosition(0)
+	{
+		// Each cell is ready for a node to be put into it on the first pass
+		for (std::size_t i = 0; i < FreeNodeCapacity; ++i)
+		{
+			mFreeNodes[i].mSequence.store(i, std::memory_order_relaxed);
+			mFreeNodes[i].mNode = nullptr;
+		}
+
+		// The queue always keeps one node whose item has already been popped, so producers never see it empty
+		Node* stub = new Node{ { nullptr }, T() };
+		mHead.store(stub, std::memory_order_relaxed);
+		mTail = stub;
+	}
+
+	template<typename T>
+	MpscQueue<T>::~MpscQueue()
+	{
+		while (mTail != nullptr)
+		{
+			Node* next = mTail->mNext.load(std::memory_order_relaxed);
+			delete mTail;
+			mTail = next;
+		}
+
+		for (std::size_t position = mFreeTakePosition.load(std::memory_order_relaxed); position != mFreePutPosition; ++position)
+		{
+			delete mFreeNodes[position % FreeNodeCapacity].mNode;
+		}
+		delete[] mFreeNodes;
+	}
+
+	template<typename T>
+	void MpscQueue<T>::Push(const T& item)
+	{
+		Node* node = AcquireNode(item);
+
+		// Claim the back of the queue, then link the previous node to it
+		Node* previous = mHead.exchange(node, std::memory_order_acq_rel);
+		previous->mNext.store(node, std::memory_order_release);
+	}
+
+	template<typename T>
+	bool MpscQueue<T>::TryPop(T& item)
+	{
+		Node* next = mTail->mNext.load(std::memory_order_acquire);
+		if (next == nullptr)
+		{
+			return false;
+		}
+
+		// The popped node becomes the new stub; the producer that linked behind the old one is done with it
+		item = next->mItem;
+		RecycleNode(mTail);
+		mTail = next;
+
+		return true;
+	}
+
+	template<typename T>
+	typename MpscQueue<T>::Node* MpscQueue<T>::AcquireNode(const T& item)
+	{
+		std::size_t position = mFreeTakePosition.load(std::memory_order_relaxed);
+		for (;;)
+		{
+			FreeCell& cell = mFreeNodes[position % FreeNodeCapacity];
+			const std::size_t sequence = cell.mSequence.load(std::memory_order_acquire);
+			const std::ptrdiff_t difference = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(position + 1);
+			if (difference == 0)
+			{
+				// The cell holds a node for this position; whichever producer moves the position on gets it
+				if (mFreeTakePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+				{
+					Node* node = cell.mNode;
+					cell.mSequence.store(position + FreeNodeCapacity, std::memory_order_release);
+					node->mNext.store(nullptr, std::memory_order_relaxed);
+					node->mItem = item;
+					return node;
+				}
+			}
+			else if (difference < 0)
+			{
+				// The ring is empty
+				return new Node{ { nullptr }, item };
+			}
+			else
+			{
+				// Another producer took this cell first
+				position = mFreeTakePosition.load(std::memory_order_relaxed);
+			}
+		}
+	}
+
+	template<typename T>
+	void MpscQueue<T>::RecycleNode(Node* node)
+	{
+		// Only the consumer puts nodes back, so the put position needs no synchronization of its own
+		FreeCell& cell = mFreeNodes[mFreePutPosition % FreeNodeCapacity];
+		if (cell.mSequence.load(std::memory_order_acquire) != mFreePutPosition)
+		{
+			// The ring is full, or a producer has claimed this cell's node and not yet released the cell
+			delete node;
+			return;
+		}
+
+		cell.mNode = node;
+		cell.mSequence.store(mFreePutPosition + 1, std::memory_order_release);
+		++mFreePutPosition;
+	}
+}
@@ -0,0 +1,131 @@
+#include "pch.h"
+
+namespace Library
+{
+	Pool::Pool(const std::size_t chunkSize, const std::uint32_t chunksPerBlock, Allocator& backingAllocator) :
+		mBackingAllocator(&backingAllocator), mChunkSize(AlignUp(chunkSize < sizeof(FreeChunk) ? sizeof(FreeChunk) : chunkSize)),
+		mChunksPerBlock(chunksPerBlock), mBlockCount(0), mBlocks(nullptr), mFreeChunks(nullptr),
+		mCursor(nullptr), mEnd(nullptr)
+	{
+		if (mChunksPerBlock == 0)
+		{
+			throw std::exception("A Pool block must hold at least one chunk.");
+		}
+	}
+
+	Pool::Pool(Pool&& rhs) :
+		mBackingAllocator(rhs.mBackingAllocator), mChunkSize(rhs.mChunkSize), mChunksPerBlock(rhs.mChunksPerBlock), mBlockCount(rhs.mBlockCount),
+		mBlocks(rhs.mBlocks), mFreeChunks(rhs.mFreeChunks), mCursor(rhs.mCursor), mEnd(rhs.mEnd)
+	{
+		rhs.mBlockCount = 0;
+		rhs.mBlocks = nullptr;
+		rhs.mFreeChunks = nullptr;
+		rhs.mCursor = nullptr;
+		rhs.mEnd = nullptr;
+	}
+
+	Pool& Pool::operator=(Pool&& rhs)
+	{
+		if (this != &rhs)
+		{
+			Release();
+
+			mBackingAllocator = rhs.mBackingAllocator;
+			mChunkSize = rhs.mChunkSize;
+			mChunksPerBlock = rhs.mChunksPerBlock;
+			mBlockCount = rhs.mBlockCount;
+			mBlocks = rhs.mBlocks;
+			mFreeChunks = rhs.mFreeChunks;
+			mCursor = rhs.mCursor;
+			mEnd = rhs.mEnd;
+
+			rhs.mBlockCount = 0;
+			rhs.mBlocks = nullptr;
+			rhs.mFreeChunks = nullptr;
+			rhs.mCursor = nullptr;
+			rhs.mEnd = nullptr;
+		}
+
+		return *this;
+	}
+
+	Pool::~Pool()
+	{
+		Release();
+	}
+
+	void* Pool::Allocate()
+	{
+		if (mFreeChunks != nullptr)
+		{
+			FreeChunk* chunk = mFreeChunks;
+			mFreeChunks = chunk->mNext;
+			return chunk;
+		}
+
+		if (mCursor == mEnd)
+		{
+			// The newest block is used up, the block header is padded so the chunks stay aligned
+			const std::size_t headerSize = AlignUp(sizeof(Block));
+			char* memory = static_cast<char*>(mBackingAllocator->Allocate(BlockSize()));
+
+			Block* block = reinterpret_cast<Block*>(memory);
+			block->mNext = mBlocks;
+			mBlocks = block;
+			++mBlockCount;
+
+			mCursor = memory + headerSize;
+			mEnd = mCursor + (mChunkSize * mChunksPerBlock);
+		}
+
+		void* chunk = mCursor;
+		mCursor += mChunkSize;
+		return chunk;
+	}
+
+	void Pool::Deallocate(void* chunk)
+	{
+		if (chunk != nullptr)
+		{
+			FreeChunk* freeChunk = static_cast<FreeChunk*>(chunk);
+			freeChunk->mNext = mFreeChunks;
+			mFreeChunks = freeChunk;
+		}
+	}
+
+	std::size_t Pool::ChunkSize() const
+	{
+		return mChunkSize;
+	}
+
+	std::uint32_t Pool::BlockCount() const
+	{
+		return mBlockCount;
+	}
+
+	std::size_t Pool::AlignUp(const std::size_t size)
+	{
+		const std::size_t alignment = alignof(std::max_align_t);
+		return (size + alignment - 1) & ~(alignment - 1);
+	}
+
+	std::size_t Pool::BlockSize() const
+	{
+		return AlignUp(sizeof(Block)) + (mChunkSize * mChunksPerBlock);
+	}
+
+	void Pool::Release()
+	{
+		while (mBlocks != nullptr)
+		{
+			Block* next = mBlocks->mNext;
+			mBackingAllocator->Deallocate(mBlocks, BlockSize());
+			mBlocks = next;
+		}
+
+		mBlockCount = 0;
+		mFreeChunks = nullptr;
+		mCursor = nullptr;
+		mEnd = nullptr;
+	}
+}
@@ -0,0 +1,108 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include "Allocator.h"
+
+namespace Library
+{
+	/**
+	 * @brief A pool of fixed-size chunks of memory.
+	 *
+	 * Chunks are carved out of larger blocks with a pointer bump, and freed chunks are kept on
+	 * a free list and handed out again before any new memory is taken, so a container that
+	 * allocates and frees nodes of one size rarely touches the global heap. Blocks are only
+	 * returned to the backing Allocator when the Pool is destroyed. A Pool is not thread-safe.
+	 */
+	class Pool final
+	{
+	public:
+		/**
+		 * Constructs a Pool. No memory is allocated until the first chunk is requested.
+		 *
+		 * @param chunkSize the size of each chunk, in bytes
+		 * @param chunksPerBlock the number of chunks carved out of each block
+		 * @param backingAllocator the Allocator the blocks come from
+		 */
+		explicit Pool(const std::size_t chunkSize, const std::uint32_t chunksPerBlock = DefaultChunksPerBlock, Allocator& backingAllocator = Allocator::Default());
+
+		// Chunks belong to the Pool that handed them out, so a Pool cannot be copied
+		Pool(const Pool& rhs) = delete;
+		Pool& operator=(const Pool& rhs) = delete;
+
+		/**
+		 * Move constructor. Takes over the blocks of the other Pool, which is left empty.
+		 *
+		 * @param rhs the Pool to move from
+		 */
+		Pool(Pool&& rhs);
+
+		/**
+		 * Move assignment operator. Releases this Pool's blocks and takes over the blocks of the
+		 * other Pool, which is left empty.
+		 *
+		 * @param rhs the Pool to move from
+		 * @return a reference to this Pool
+		 */
+		Pool& operator=(Pool&& rhs);
+
+		/**
+		 * Destructor. Returns every block to the backing Allocator. Chunks must not be used afterwards.
+		 */
+		~Pool();
+
+		/**
+		 * Returns an uninitialized chunk of memory.
+		 *
+		 * @return the address of the chunk
+		 */
+		void* Allocate();
+
+		/**
+		 * Returns a chunk to the Pool so it can be handed out again.
+		 *
+		 * @param chunk the address of a chunk handed out by this Pool, or nullptr
+		 */
+		void Deallocate(void* chunk);
+
+		/**
+		 * Returns the size of each chunk, including any padding added for alignment.
+		 *
+		 * @return the size of each chunk, in bytes
+		 */
+		std::size_t ChunkSize() const;
+
+		/**
+		 * Returns the number of blocks the Pool has taken from the backing Allocator.
+		 *
+		 * @return the number of blocks
+		 */
+		std::uint32_t BlockCount() const;
+
+		static const std::uint32_t DefaultChunksPerBlock = 32;		/**< The number of chunks in a block when none is given */
+
+	private:
+		struct Block
+		{
+			Block* mNext;					/**< The block allocated before this one */
+		};
+
+		struct FreeChunk
+		{
+			FreeChunk* mNext;				/**< The next chunk on the free list */
+		};
+
+		static std::size_t AlignUp(const std::size_t size);
+		std::size_t BlockSize() const;
+		void Release();
+
+		Allocator* mBackingAllocator;		/**< Where the blocks come from */
+		std::size_t mChunkSize;				/**< The size of each chunk, rounded up for alignment */
+		std::uint32_t mChunksPerBlock;		/**< The number of chunks in each block */
+		std::uint32_t mBlockCount;			/**< The number of blocks taken from the backing Allocator */
+		Block* mBlocks;						/**< The most recently allocated block */
+		FreeChunk* mFreeChunks;				/**< Chunks that have been returned to the Pool */
+		char* mCursor;						/**< The next unused chunk in the newest block */
+		char* mEnd;							/**< One past the last chunk in the newest block */
+	};
+}
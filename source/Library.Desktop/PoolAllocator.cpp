@@ -0,0 +1,43 @@
+#include "pch.h"
+
+namespace Library
+{
+	PoolAllocator::PoolAllocator(const std::size_t chunkSize, const std::uint32_t chunksPerBlock, Allocator& backingAllocator) :
+		mPool(chunkSize, chunksPerBlock, backingAllocator)
+	{
+	}
+
+	const Pool& PoolAllocator::GetPool() const
+	{
+		return mPool;
+	}
+
+	void* PoolAllocator::DoAllocate(const std::size_t size)
+	{
+		if (size > mPool.ChunkSize())
+		{
+			throw std::exception("The requested size is larger than the PoolAllocator's chunk size.");
+		}
+
+		return mPool.Allocate();
+	}
+
+	void* PoolAllocator::DoReallocate(void* memory, const std::size_t oldSize, const std::size_t newSize)
+	{
+		UNREFERENCED_PARAMETER(oldSize);
+
+		if (newSize > mPool.ChunkSize())
+		{
+			throw std::exception("The requested size is larger than the PoolAllocator's chunk size.");
+		}
+
+		// Every chunk is the same size, so the block already fits
+		return memory;
+	}
+
+	void PoolAllocator::DoDeallocate(void* memory, const std::size_t size)
+	{
+		UNREFERENCED_PARAMETER(size);
+		mPool.Deallocate(memory);
+	}
+}
@@ -0,0 +1,47 @@
+#pragma once
+
+#include "Allocator.h"
+#include "Pool.h"
+
+namespace Library
+{
+	/**
+	 * @brief An Allocator that hands out fixed-size chunks from a Pool.
+	 *
+	 * Suited to objects that are all the same size and are created and destroyed often, such
+	 * as events or list nodes. Any request up to the chunk size is served from the Pool;
+	 * larger requests throw. A PoolAllocator is not thread-safe.
+	 */
+	class PoolAllocator final : public Allocator
+	{
+	public:
+		/**
+		 * Constructs a PoolAllocator. No memory is taken until the first allocation.
+		 *
+		 * @param chunkSize the largest block the Allocator can hand out, in bytes
+		 * @param chunksPerBlock the number of chunks the Pool carves out of each block
+		 * @param backingAllocator the Allocator the Pool's blocks come from
+		 */
+		explicit PoolAllocator(const std::size_t chunkSize, const std::uint32_t chunksPerBlock = Pool::DefaultChunksPerBlock, Allocator& backingAllocator = Allocator::Default());
+
+		/**
+		 * Default deconstructor.
+		 */
+		virtual ~PoolAllocator() = default;
+
+		/**
+		 * Returns the Pool the chunks come from.
+		 *
+		 * @return a reference to the Pool
+		 */
+		const Pool& GetPool() const;
+
+	protected:
+		virtual void* DoAllocate(const std::size_t size) override;
+		virtual void* DoReallocate(void* memory, const std::size_t oldSize, const std::size_t newSize) override;
+		virtual void DoDeallocate(void* memory, const std::size_t size) override;
+
+	private:
+		Pool mPool;				/**< The chunks handed out by the Allocator */
+	};
+}
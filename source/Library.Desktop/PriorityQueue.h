@@ -0,0 +1,109 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+
+namespace Library
+{
+	/**
+	 * A container that always hands out its smallest item first, kept as a binary min-heap on
+	 * top of a Vector. Pushing and popping take O(log n) and looking at the smallest item is O(1).
+	 * Items that compare equal come out in no particular order.
+	 */
+	template<typename T, typename LessT = std::less<T>>
+	class PriorityQueue
+	{
+	public:
+		/**
+		 * Default constructor.
+		 *
+		 * @param allocator the Allocator the PriorityQueue's items come from
+		 */
+		explicit PriorityQueue(Allocator& allocator = Allocator::Default());
+
+		/**
+		 * Copy constructor.
+		 *
+		 * @param rhs the PriorityQueue to copy from
+		 */
+		PriorityQueue(const PriorityQueue& rhs) = default;
+
+		/**
+		 * Move constructor. The other PriorityQueue is left empty.
+		 *
+		 * @param rhs the PriorityQueue to move from
+		 */
+		PriorityQueue(PriorityQueue&& rhs);
+
+		/**
+		 * Overloads the assignment operator.
+		 *
+		 * @param rhs the PriorityQueue to assign from
+		 */
+		PriorityQueue& operator=(const PriorityQueue& rhs) = default;
+
+		/**
+		 * Move assignment operator. The other PriorityQueue is left empty.
+		 *
+		 * @param rhs the PriorityQueue to move from
+		 * @return a reference to this PriorityQueue
+		 */
+		PriorityQueue& operator=(PriorityQueue&& rhs);
+
+		/**
+		 * Default deconstructor.
+		 */
+		~PriorityQueue() = default;
+
+		/**
+		 * Adds an item to the PriorityQueue.
+		 *
+		 * @param item the item to add
+		 */
+		void Push(const T& item);
+
+		/**
+		 * Removes and returns the smallest item.
+		 *
+		 * @return the smallest item
+		 */
+		T Pop();
+
+		/**
+		 * Returns the smallest item without removing it.
+		 *
+		 * @return the smallest item
+		 */
+		const T& Top() const;
+
+		/**
+		 * Returns the number of items in the PriorityQueue.
+		 *
+		 * @return the number of items
+		 */
+		std::uint32_t Size() const;
+
+		/**
+		 * Returns whether the PriorityQueue is empty.
+		 *
+		 * @return true if the PriorityQueue is empty, false otherwise
+		 */
+		bool IsEmpty() const;
+
+		/**
+		 * Removes every item from the PriorityQueue.
+		 */
+		void Clear();
+
+		static const std::uint32_t DefaultCapacity = 16;		/**< The number of items reserved by the first Push */
+
+	private:
+		void SiftUp(std::uint32_t index);
+		void SiftDown(std::uint32_t index);
+
+		Vector<T> mHeap;				/**< The items, each no larger than its two children */
+		LessT mLess;					/**< Orders the items */
+	};
+}
+
+#include "PriorityQueue.inl"
@@ -0,0 +1,130 @@
+#include "pch.h"
+
+namespace Library
+{
+	template<typename T, typename LessT>
+	PriorityQueue<T, LessT>::PriorityQueue(Allocator& allocator) :
+		mHeap(0, false, allocator), mLess()
+	{
+	}
+
+	template<typename T, typename LessT>
+	PriorityQueue<T, LessT>::PriorityQueue(PriorityQueue&& rhs) :
+		mHeap(std::move(rhs.mHeap)), mLess(rhs.mLess)
+	{
+	}
+
+	template<typename T, typename LessT>
+	PriorityQueue<T, LessT>& PriorityQueue<T, LessT>::operator=(PriorityQueue&& rhs)
+	{
+		if (this != &rhs)
+		{
+			mHeap = std::move(rhs.mHeap);
+			mLess = rhs.mLess;
+		}
+
+		return *this;
+	}
+
+	template<typename T, typename LessT>
+	void PriorityQueue<T, LessT>::Push(const T& item)
+	{
+		// Vector grows one item at a time by default, which large queues cannot afford
+		if (mHeap.Size() == mHeap.Capacity())
+		{
+			mHeap.Reserve(mHeap.Capacity() == 0 ? DefaultCapacity : mHeap.Capacity() * 2);
+		}
+
+		mHeap.PushBack(item);
+		SiftUp(mHeap.Size() - 1);
+	}
+
+	template<typename T, typename LessT>
+	T PriorityQueue<T, LessT>::Pop()
+	{
+		T topItem = Top();
+
+		// The last leaf takes the root's place and sinks back down to where it belongs
+		mHeap[0] = mHeap.Back();
+		mHeap.PopBack();
+		if (!mHeap.IsEmpty())
+		{
+			SiftDown(0);
+		}
+
+		return topItem;
+	}
+
+	template<typename T, typename LessT>
+	const T& PriorityQueue<T, LessT>::Top() const
+	{
+		return mHeap.Front();
+	}
+
+	template<typename T, typename LessT>
+	std::uint32_t PriorityQueue<T, LessT>::Size() const
+	{
+		return mHeap.Size();
+	}
+
+	template<typename T, typename LessT>
+	bool PriorityQueue<T, LessT>::IsEmpty() const
+	{
+		return mHeap.IsEmpty();
+	}
+
+	template<typename T, typename LessT>
+	void PriorityQueue<T, LessT>::Clear()
+	{
+		mHeap.Clear();
+	}
+
+	template<typename T, typename LessT>
+	void PriorityQueue<T, LessT>::SiftUp(std::uint32_t index)
+	{
+		T item = mHeap[index];
+		while (index > 0)
+		{
+			const std::uint32_t parent = (index - 1) / 2;
+			if (!mLess(item, mHeap[parent]))
+			{
+				break;
+			}
+
+			mHeap[index] = mHeap[parent];
+			index = parent;
+		}
+
+		mHeap[index] = item;
+	}
+
+	template<typename T, typename LessT>
+	void PriorityQueue<T, LessT>::SiftDown(std::uint32_t index)
+	{
+		const std::uint32_t size = mHeap.Size();
+		T item = mHeap[index];
+		for (;;)
+		{
+			std::uint32_t child = index * 2 + 1;
+			if (child >= size)
+			{
+				break;
+			}
+
+			if (child + 1 < size && mLess(mHeap[child + 1], mHeap[child]))
+			{
+				++child;
+			}
+
+			if (!mLess(mHeap[child], item))
+			{
+				break;
+			}
+
+			mHeap[index] = mHeap[child];
+			index = child;
+		}
+
+		mHeap[index] = item;
+	}
+}
@@ -4,36 +4,146 @@ namespace Library
 {
 	RTTI_DEFINITIONS(ReactionAttributed)
 
+	/**
+	 * Files every ReactionAttributed under its subtype and forwards each attributed event to the
+	 * reactions of the event's subtype only. It subscribes to Event<EventMessageAttributed> while
+	 * any reactions exist.
+	 *
+	 * Each subtype's reactions are published as an immutable snapshot, the way SubscriberList
+	 * publishes subscribers: filing a reaction copies the list and swaps the copy in, so a
+	 * delivery only takes a reference to the current snapshot rather than copying the list.
+	 * Reactions are only refiled on the thread that sets their subtype, so a delivery never
+	 * reads a reaction's subtype; it looks the event's subtype up once and notifies what it finds.
+	 */
+	struct ReactionAttributed::Dispatcher final : public IEventSubscriber
+	{
+		typedef Vector<ReactionAttributed*> Reactions;
+		typedef std::shared_ptr<const Reactions> Snapshot;
+
+		Dispatcher() :
+			mReactions(DefaultNumberOfBuckets), mCount(0)
+		{
+		}
+
+		virtual void Notify(const EventPublisher& publisher) override
+		{
+			Event<EventMessageAttributed>* event = publisher.As<Event<EventMessageAttributed>>();
+			assert(event);
+			EventMessageAttributed& message = const_cast<EventMessageAttributed&>(event->Message());
+
+			// A subtype that was never interned has no reactions filed under it
+			const Symbol subtype = Symbol::Find(message.GetSubtype());
+			if (subtype.IsEmpty())
+			{
+				return;
+			}
+
+			// Reactions can create or destroy other reactions, so they are notified outside the lock
+			Snapshot reactions;
+			{
+				std::shared_lock<std::shared_timed_mutex> lock(mMutex);
+				auto it = mReactions.Find(subtype);
+				if (it == mReactions.end())
+				{
+					return;
+				}
+				reactions = it->second;
+			}
+
+			for (ReactionAttributed* reaction : *reactions)
+			{
+				reaction->Respond(message);
+			}
+		}
+
+		void Add(ReactionAttributed& reaction, const Symbol& subtype)
+		{
+			Snapshot& snapshot = mReactions[subtype];
+			Reactions reactions(snapshot != nullptr ? *snapshot : Reactions());
+			reactions.PushBack(&reaction);
+			snapshot = std::make_shared<Reactions>(std::move(reactions));
+
+			if (mCount++ == 0)
+			{
+				Event<EventMessageAttributed>::Subscribe(*this);
+			}
+		}
+
+		void Remove(ReactionAttributed& reaction, const Symbol& subtype)
+		{
+			auto it = mReactions.Find(subtype);
+			assert(it != mReactions.end());
+			Reactions reactions(*it->second);
+			reactions.Remove(&reaction);
+			if (reactions.IsEmpty())
+			{
+				mReactions.Remove(subtype);
+			}
+			else
+			{
+				it->second = std::make_shared<Reactions>(std::move(reactions));
+			}
+
+			if (--mCount == 0)
+			{
+				Event<EventMessageAttributed>::Unsubscribe(*this);
+			}
+		}
+
+		static const std::uint32_t DefaultNumberOfBuckets = 64;
+
+		std::shared_timed_mutex mMutex;				/**< Guards the map; the snapshots it holds never change */
+		HashMap<Symbol, Snapshot> mReactions;		/**< The reactions filed under each subtype */
+		std::uint32_t mCount;						/**< The number of reactions filed under any subtype */
+	};
+
 	ReactionAttributed::ReactionAttributed(const std::string& name)
 		: Reaction(name)
 	{
 		InitializeSignatures();
-		Event<EventMessageAttributed>::Subscribe(*this);
+
+		Dispatcher& dispatcher = GetDispatcher();
+		std::lock_guard<std::shared_timed_mutex> lock(dispatcher.mMutex);
+		dispatcher.Add(*this, mFiledSubtype);
 	}
 
 	ReactionAttributed::~ReactionAttributed()
 	{
 		// Remove ourself from the subscription list before destroying
-		Event<EventMessageAttributed>::Unsubscribe(*this);
+		Dispatcher& dispatcher = GetDispatcher();
+		std::lock_guard<std::shared_timed_mutex> lock(dispatcher.mMutex);
+		dispatcher.Remove(*this, mFiledSubtype);
 	}
 
 	void ReactionAttributed::Notify(const EventPublisher& publisher)
 	{
 		Event<EventMessageAttributed>* newEvent = publisher.As<Event<EventMessageAttributed>>();
 		assert(newEvent);
-
 		EventMessageAttributed& message = const_cast<EventMessageAttributed&>(newEvent->Message());
+
 		if (message.GetSubtype() == mSubtype)
 		{
-			// Copy the attribute arguments to this instance
-			for (std::uint32_t i = message.AuxiliaryBegin(); i < message.Size(); ++i)
-			{
-				// TODO: Copy each attribute
-				AppendAuxiliaryAttribute(message.GetSubtype());
-			}
+			Respond(message);
 		}
+	}
+
+	const std::string& ReactionAttributed::GetSubtype() const
+	{
+		return mSubtype;
+	}
 
-		Update(const_cast<WorldState&>(message.GetWorld().GetWorldState()));
+	void ReactionAttributed::SetSubtype(const std::string& subtype)
+	{
+		mSubtype = subtype;
+		Refile();
+	}
+
+	std::uint32_t ReactionAttributed::ReactionCount(const std::string& subtype)
+	{
+		Dispatcher& dispatcher = GetDispatcher();
+		std::shared_lock<std::shared_timed_mutex> lock(dispatcher.mMutex);
+		auto it = dispatcher.mReactions.Find(Symbol::Find(subtype));
+		return (it == dispatcher.mReactions.end() ? 0 : it->second->Size());
 	}
 
 	void ReactionAttributed::InitializeSignatures()
@@ -42,4 +152,37 @@ namespace Library
 		Populate();
 	}
 
+	ReactionAttributed::Dispatcher& ReactionAttributed::GetDispatcher()
+	{
+		static Dispatcher dispatcher;
+		return dispatcher;
+	}
+
+	void ReactionAttributed::Refile()
+	{
+		const Symbol subtype(mSubtype);
+		if (subtype != mFiledSubtype)
+		{
+			// Filed under the new subtype first, so the dispatcher never drops to no reactions and unsubscribes
+			Dispatcher& dispatcher = GetDispatcher();
+			std::lock_guard<std::shared_timed_mutex> lock(dispatcher.mMutex);
+			dispatcher.Add(*this, subtype);
+			dispatcher.Remove(*this, mFiledSubtype);
+			mFiledSubtype = subtype;
+		}
+	}
+
+	void ReactionAttributed::Respond(EventMessageAttributed& message)
+	{
+		// A "subtype" written through the attribute without a Refile leaves the Reaction filed under its old subtype
+		assert(Symbol::Find(mSubtype) == mFiledSubtype);
+
+		// Copy the attribute arguments to this instance
+		for (std::uint32_t i = message.AuxiliaryBegin(); i < message.Size(); ++i)
+		{
+			AppendAuxiliaryAttribute(message.NameAt(i).Name()) = message[i];
+		}
+
+		ActionList::Update(const_cast<WorldState&>(message.GetWorld().GetWorldState()));
+	}
 }
@@ -5,9 +5,17 @@
 namespace Library
 {
 	class EventPublisher;
+	class EventMessageAttributed;
 
 	/**
 	 * Allows for Reaction notifications. This may be specialised for specific types of Reactions.
+	 *
+	 * Reactions are filed by subtype in a shared dispatcher, which is the only subscriber to
+	 * Event<EventMessageAttributed> on their behalf. An attributed event is handed straight to
+	 * the reactions of its subtype; every other reaction is skipped without being notified.
+	 * A Reaction is refiled when its subtype is set through SetSubtype or by the XML parser.
+	 * Code that writes the "subtype" attribute directly must call Refile afterwards; until then
+	 * the Reaction only gets events of its old subtype, and debug builds assert when one arrives.
 	 */
 	class ReactionAttributed final : public Reaction
 	{
@@ -28,19 +36,55 @@ namespace Library
 
 		/**
 		 * Notification to trigger when an event is received. Generally will invoke
-		 * ActionList::Update()
+		 * ActionList::Update(). Events of other subtypes are ignored. The dispatcher does not
+		 * go through here, since it only hands a Reaction the events of its subtype.
 		 *
 		 * @param the event from a publisher
 		 */
 		virtual void Notify(const EventPublisher& publisher) override;
 
+		/**
+		 * Returns the subtype of the events this Reaction responds to.
+		 *
+		 * @return the subtype
+		 */
+		const std::string& GetSubtype() const;
+
+		/**
+		 * Sets the subtype of the events this Reaction responds to, and refiles the Reaction in
+		 * the dispatcher right away.
+		 *
+		 * @param subtype the subtype
+		 */
+		void SetSubtype(const std::string& subtype);
+
+		/**
+		 * Files the Reaction under the subtype held by its "subtype" attribute, so events of that
+		 * subtype reach it. Call after writing the attribute directly.
+		 */
+		void Refile();
+
+		/**
+		 * Returns the number of Reactions that attributed events of a subtype are delivered to.
+		 *
+		 * @param subtype the subtype
+		 * @return the number of Reactions filed under the subtype
+		 */
+		static std::uint32_t ReactionCount(const std::string& subtype);
+
 		/**
 		 * Initializes internal and external attributes.
 		 */
 		void InitializeSignatures();
 
 	private:
-		std::string mSubtype;		/**< The subtype. */
+		struct Dispatcher;
+		static Dispatcher& GetDispatcher();
+
+		void Respond(EventMessageAttributed& message);
+
+		std::string mSubtype;			/**< The subtype. */
+		Symbol mFiledSubtype;			/**< The subtype the dispatcher has this Reaction filed under. */
 	};
 
 	ActionFactory(ReactionAttributed)
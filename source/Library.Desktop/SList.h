@@ -49,9 +49,13 @@ namespace Library
 			T mData;					/**< The data the Node contains. */
 		};
 
+		Node* CreateNode(const T& data, Node* next = nullptr);
+		void DestroyNode(Node* node);
+
 		Node* mFront;				/**< Pointer to the Node at the front of the list. */
 		Node* mBack;				/**< Pointer to the Node at the back of the list. */
 		std::uint32_t mSize;		/**< The number of nodes in the list */
+		Pool mNodePool;				/**< Hands out and recycles the memory for the list's Nodes */
 
 	public:
 		/**
@@ -141,8 +145,10 @@ namespace Library
 
 		/**
 		 * Constructor that initializes the list.
+		 *
+		 * @param allocator the Allocator the list's Nodes come from
 		 */
-		SList();
+		explicit SList(Allocator& allocator = Allocator::Default());
 
 		/**
 		 * Copy-constructor that does a deep copy.
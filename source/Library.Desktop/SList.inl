@@ -119,8 +119,8 @@ namespace Library
 #pragma endregion
 
 	template<typename T>
-	SList<T>::SList() :
-		mFront(nullptr), mBack(nullptr), mSize(0)
+	SList<T>::SList(Allocator& allocator) :
+		mFront(nullptr), mBack(nullptr), mSize(0), mNodePool(sizeof(Node), Pool::DefaultChunksPerBlock, allocator)
 	{
 	}
 
@@ -193,8 +193,7 @@ namespace Library
 	template<typename T>
 	typename SList<T>::Iterator SList<T>::PushFront(const T& data)
 	{
-		Node* node = new Node(data);
-		node->mNextNode = mFront;
+		Node* node = CreateNode(data, mFront);
 		mFront = node;
 		if (mBack == nullptr)
 		{
@@ -215,7 +214,7 @@ namespace Library
 
 		Node* newFront = mFront->mNextNode;
 
-		delete mFront;
+		DestroyNode(mFront);
 		mFront = newFront;
 		--mSize;
 
@@ -229,7 +228,7 @@ namespace Library
 	template<typename T>
 	typename SList<T>::Iterator SList<T>::PushBack(const T& data)
 	{
-		Node* node = new Node(data);
+		Node* node = CreateNode(data);
 
 		if (mBack != nullptr)
 		{
@@ -318,7 +317,7 @@ namespace Library
 		}
 		else
 		{
-			Node* newNode = new Node(value, it.mNode->mNextNode);
+			Node* newNode = CreateNode(value, it.mNode->mNextNode);
 			it.mNode->mNextNode = newNode;
 			++mSize;
 		}
@@ -399,7 +398,7 @@ namespace Library
 					mBack = previousIter.mNode;
 				}
 
-				delete deleteNode;
+				DestroyNode(deleteNode);
 				deleteNode = nullptr;
 				--mSize;
 
@@ -411,4 +410,17 @@ namespace Library
 			}
 		}
 	}
+
+	template<typename T>
+	typename SList<T>::Node* SList<T>::CreateNode(const T& data, Node* next)
+	{
+		return new(mNodePool.Allocate()) Node(data, next);
+	}
+
+	template<typename T>
+	void SList<T>::DestroyNode(Node* node)
+	{
+		node->~Node();
+		mNodePool.Deallocate(node);
+	}
 }
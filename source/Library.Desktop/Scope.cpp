@@ -4,19 +4,91 @@ namespace Library
 {
 	RTTI_DEFINITIONS(Scope)
 
+	thread_local Allocator* Scope::sCurrentAllocator = nullptr;
+
+#pragma region AllocatorGuard
+
+	Scope::AllocatorGuard::AllocatorGuard(Allocator& allocator) :
+		mPreviousAllocator(sCurrentAllocator)
+	{
+		sCurrentAllocator = &allocator;
+	}
+
+	Scope::AllocatorGuard::~AllocatorGuard()
+	{
+		sCurrentAllocator = mPreviousAllocator;
+	}
+
+#pragma endregion
+
 #pragma region Scope
 
+	void* Scope::operator new(std::size_t size)
+	{
+		// The header in front of the Scope remembers where the memory has to go back to
+		Allocator& allocator = CurrentAllocator();
+		AllocationHeader* header = static_cast<AllocationHeader*>(allocator.Allocate(sizeof(AllocationHeader) + size));
+		header->mAllocator = &allocator;
+		header->mSize = size;
+		return header + 1;
+	}
+
+	void Scope::operator delete(void* memory)
+	{
+		if (memory != nullptr)
+		{
+			AllocationHeader* header = static_cast<AllocationHeader*>(memory) - 1;
+			header->mAllocator->Deallocate(header, sizeof(AllocationHeader) + header->mSize);
+		}
+	}
+
+	void* Scope::operator new(std::size_t size, const std::nothrow_t&) noexcept
+	{
+		try
+		{
+			return operator new(size);
+		}
+		catch (...)
+		{
+			return nullptr;
+		}
+	}
+
+	void Scope::operator delete(void* memory, const std::nothrow_t&)
+	{
+		operator delete(memory);
+	}
+
+	void* Scope::operator new(std::size_t size, void* memory) noexcept
+	{
+		return ::operator new(size, memory);
+	}
+
+	void Scope::operator delete(void* memory, void* place)
+	{
+		::operator delete(memory, place);
+	}
+
 	Scope::Scope(const std::uint32_t initialCapacity) :
-		mData(DefaultNumberOfBuckets), mOrderedData(initialCapacity), mParent(nullptr)
+		mAllocator(&CurrentAllocator()), mData(DefaultNumberOfBuckets, HashMap<Symbol, TablePair*>::DefaultMaxLoadFactor, *mAllocator),
+		mOrderedData(initialCapacity, false, *mAllocator), mParent(nullptr), mParentDatum(nullptr), mParentIndex(0), mRevision(0)
 	{
+		mData.Reserve(initialCapacity);
 	}
 
 	Scope::Scope(const Scope& rhs) :
-		mData(DefaultNumberOfBuckets), mOrderedData(), mParent(nullptr)
+		mAllocator(&CurrentAllocator()), mData(DefaultNumberOfBuckets, HashMap<Symbol, TablePair*>::DefaultMaxLoadFactor, *mAllocator),
+		mOrderedData(0, false, *mAllocator), mParent(nullptr), mParentDatum(nullptr), mParentIndex(0), mRevision(0)
 	{
 		operator=(rhs);
 	}
 
+	Scope::Scope(Scope&& rhs) :
+		mAllocator(rhs.mAllocator), mData(std::move(rhs.mData)), mOrderedData(std::move(rhs.mOrderedData)), mParent(nullptr), mParentDatum(nullptr), mParentIndex(0), mRevision(0)
+	{
+		TakeOver(rhs);
+	}
+
 #pragma region Operator Overloads
 
 	Scope& Scope::operator=(const Scope& rhs)
@@ -25,20 +97,45 @@ namespace Library
 		{
 			Clear();
 
+			// The slot only describes where this scope sits in its own parent
+			if (mParent != rhs.mParent)
+			{
+				mParentDatum = nullptr;
+				mParentIndex = 0;
+			}
 			mParent = rhs.mParent;
 
-			// Rebuild the HashMap
+			// Rebuild the HashMap, sizing it up front so it never has to grow part way through
+			mData.Reserve(rhs.Size());
+			mOrderedData.Reserve(rhs.Size());
 			for (const auto& data : rhs.mOrderedData)
 			{
-				// This does not preserve the old HashMap order
-				auto it = mData.Insert(std::pair<std::string, Datum>(data->first, data->second));
-				mOrderedData.PushBack(&*it);
+				TablePair* pair = CreatePair(data->first);
+				pair->second = data->second;
+				mData.Insert(HashMap<Symbol, TablePair*>::PairType(pair->first, pair));
+				mOrderedData.PushBack(pair);
 			}
 		}
 
 		return *this;
 	}
 
+	Scope& Scope::operator=(Scope&& rhs)
+	{
+		if (this != &rhs)
+		{
+			// Only the entries are replaced, so this scope stays where it is in its parent
+			Clear(true);
+
+			mAllocator = rhs.mAllocator;
+			mData = std::move(rhs.mData);
+			mOrderedData = std::move(rhs.mOrderedData);
+			TakeOver(rhs);
+		}
+
+		return *this;
+	}
+
 	bool Scope::operator==(const Scope& other) const
 	{
 		if (this == &other)
@@ -85,6 +182,16 @@ namespace Library
 
 #pragma endregion
 
+	const Symbol& Scope::NameAt(const std::uint32_t index) const
+	{
+		if (index >= mOrderedData.Size())
+		{
+			throw std::exception("Index out of bounds.");
+		}
+
+		return mOrderedData[index]->first;
+	}
+
 	Scope::~Scope()
 	{
 		Clear();
@@ -99,47 +206,63 @@ namespace Library
 
 		for (const auto& pair : mOrderedData)
 		{
-			Datum& datum = pair->second;
-			if (datum.Type() == Datum::DatumType::Table)
-			{
-				for (std::uint32_t i = datum.Size(); i > 0; --i)
-				{
-					Scope* scope = datum.Get<Scope*>(i - 1);
-					if (scope != nullptr && scope->mParent == this)
-					{
-						delete scope;
-					}
-				}
-			}
+			DestroyChildren(pair->second);
+		}
+
+		for (const auto& pair : mOrderedData)
+		{
+			DestroyPair(pair);
 		}
 
 		mOrderedData.Clear();
 		mData.Clear();
+		++mRevision;
 	}
 
 	void Scope::Orphan()
 	{
 		if (mParent != nullptr)
 		{
-			Datum* foundDatum = mParent->FindContainedScope(*this);
-			assert(foundDatum != nullptr);
+			Datum* datum = mParentDatum;
+			std::uint32_t index = mParentIndex;
 
-			for (std::uint32_t i = 0; i < foundDatum->Size(); ++i)
+			// The slot is only stale if the parent's table was edited directly, in which case search for it
+			bool isSlotValid = (datum != nullptr && index < datum->Size() && datum->Get<Scope*>(index) == this);
+			if (isSlotValid || mParent->FindSlot(*this, datum, index))
 			{
-				if (foundDatum[i] == this)
+				const std::uint32_t lastIndex = datum->Size() - 1;
+				if (index != lastIndex)
 				{
-					foundDatum->RemoveTable(i);
-					break;
+					Scope* last = datum->Get<Scope*>(lastIndex);
+					if (last != nullptr && last->mParentDatum == datum && last->mParentIndex == lastIndex)
+					{
+						last->mParentIndex = index;
+					}
 				}
+
+				datum->SwapRemoveTable(index);
 			}
 
 			mParent = nullptr;
+			mParentDatum = nullptr;
+			mParentIndex = 0;
 		}
 	}
 
 	Datum* Scope::Find(const std::string& name) const
 	{
-		if (name.empty())
+		// A name that was never interned cannot be in any scope
+		return Find(Symbol::Find(name));
+	}
+
+	Datum* Scope::Find(const char* name) const
+	{
+		return Find(Symbol::Find(name));
+	}
+
+	Datum* Scope::Find(const Symbol& name) const
+	{
+		if (name.IsEmpty())
 		{
 			return nullptr;
 		}
@@ -147,13 +270,25 @@ namespace Library
 		auto foundValue = mData.Find(name);
 		if (foundValue != mData.end())
 		{
-			return &foundValue->second;
+			return &foundValue->second->second;
 		}
 
 		return nullptr;
 	}
 
 	Datum* Scope::Search(const std::string& name, Scope** scope) const
+	{
+		// Resolve the name once rather than at every level of the hierarchy
+		return Search(Symbol::Find(name), scope);
+	}
+
+	Datum* Scope::Search(const char* name, Scope** scope) const
+	{
+		// Resolve the name once rather than at every level of the hierarchy
+		return Search(Symbol::Find(name), scope);
+	}
+
+	Datum* Scope::Search(const Symbol& name, Scope** scope) const
 	{
 		if (scope != nullptr)
 		{
@@ -172,23 +307,35 @@ namespace Library
 
 	Datum& Scope::Append(const std::string& name)
 	{
-		if (name.empty())
+		return Append(Symbol(name));
+	}
+
+	Datum& Scope::Append(const Symbol& name)
+	{
+		if (name.IsEmpty())
 		{
 			throw std::exception("Cannot append an empty name.");
 		}
 
 		bool wasInserted = false;
-		HashMap<std::string, Datum>::Iterator value = mData.Insert(TablePair(name, Datum()), wasInserted);
+		HashMap<Symbol, TablePair*>::Iterator value = mData.Insert(HashMap<Symbol, TablePair*>::PairType(name, nullptr), wasInserted);
 		if (wasInserted)
 		{
-			// Only add to the table if a new value was added to the HashMap
-			mOrderedData.PushBack(&*value);
+			// Only add to the table if a new value was added to the HashMap. The pair is allocated on its own
+			// because the HashMap relocates its entries as it grows, and callers hold on to Datum references.
+			value->second = CreatePair(name);
+			mOrderedData.PushBack(value->second);
 		}
 
-		return value->second;
+		return value->second->second;
 	}
 
 	Scope& Scope::AppendScope(const std::string& name)
+	{
+		return AppendScope(Symbol(name));
+	}
+
+	Scope& Scope::AppendScope(const Symbol& name)
 	{
 		Datum& newDatum = Append(name);
 		bool isValidType = ((newDatum.Type() == Datum::DatumType::Table) || (newDatum.Type() == Datum::DatumType::Unknown));
@@ -199,10 +346,11 @@ namespace Library
 
 		assert(!newDatum.IsExternal());
 
+		AllocatorGuard guard(*mAllocator);
 		Scope* newScope = new Scope();
-		newScope->mParent = this;
 		newDatum.SetType(Datum::DatumType::Table);
 		newDatum.PushBack(*newScope);
+		newScope->SetParent(*this, newDatum, newDatum.Size() - 1);
 
 		return *newScope;
 	}
@@ -211,9 +359,9 @@ namespace Library
 	{
 		Datum& datum = Append(childName);
 		datum.SetType(Datum::DatumType::Table);
-		datum.PushBack(child);
 		child.Orphan();
-		child.mParent = this;
+		datum.PushBack(child);
+		child.SetParent(*this, datum, datum.Size() - 1);
 	}
 
 	Scope* Scope::GetParent() const
@@ -223,26 +371,9 @@ namespace Library
 
 	Datum* Scope::FindContainedScope(const Scope& scope) const
 	{
-		// Iterate over each entry in the ordered data set
-		for (auto& pair : mOrderedData)
-		{
-			Datum& datum = pair->second;
-			// Check if a scope was found
-			if (datum.Type() == Datum::DatumType::Table)
-			{
-				// Search each scope in the datum array
-				for (std::uint32_t i = 0; i < datum.Size(); ++i)
-				{
-					if (datum[i] == scope)
-					{
-						return &datum;
-					}
-				}
-			}
-		}
-
-		// No match found
-		return nullptr;
+		Datum* datum = nullptr;
+		std::uint32_t index = 0;
+		return (FindSlot(scope, datum, index) ? datum : nullptr);
 	}
 
 	std::string Scope::FindName(const Scope& searchScope) const
@@ -257,7 +388,7 @@ namespace Library
 			Datum* datum = Find(pair->first);
 			if ((datum != nullptr) && (datum->Type() == Datum::DatumType::Table))
 			{
-				return pair->first;
+				return pair->first.Name();
 			}
 		}
 
@@ -275,6 +406,125 @@ namespace Library
 		return mOrderedData.Size();
 	}
 
+	std::uint32_t Scope::Revision() const
+	{
+		return mRevision;
+	}
+
+	void Scope::Truncate(const std::uint32_t size)
+	{
+		if (mOrderedData.Size() <= size)
+		{
+			return;
+		}
+
+		while (mOrderedData.Size() > size)
+		{
+			TablePair* pair = mOrderedData.Back();
+			DestroyChildren(pair->second);
+			mData.Remove(pair->first);
+			mOrderedData.PopBack();
+			DestroyPair(pair);
+		}
+
+		++mRevision;
+	}
+
+	void Scope::SetParent(Scope& parent, Datum& datum, const std::uint32_t index)
+	{
+		mParent = &parent;
+		mParentDatum = &datum;
+		mParentIndex = index;
+	}
+
+	bool Scope::FindSlot(const Scope& child, Datum*& datum, std::uint32_t& index) const
+	{
+		for (const auto& pair : mOrderedData)
+		{
+			Datum& candidate = pair->second;
+			if (candidate.Type() == Datum::DatumType::Table)
+			{
+				for (std::uint32_t i = 0; i < candidate.Size(); ++i)
+				{
+					if (candidate.Get<Scope*>(i) == &child)
+					{
+						datum = &candidate;
+						index = i;
+						return true;
+					}
+				}
+			}
+		}
+
+		return false;
+	}
+
+	Allocator& Scope::GetAllocator() const
+	{
+		return *mAllocator;
+	}
+
+	Allocator& Scope::CurrentAllocator()
+	{
+		return (sCurrentAllocator != nullptr ? *sCurrentAllocator : Allocator::Default());
+	}
+
+	Scope::TablePair* Scope::CreatePair(const Symbol& name)
+	{
+		void* memory = mAllocator->Allocate(sizeof(TablePair));
+		return new(memory)TablePair(name, Datum(Datum::DatumType::Unknown, 0, *mAllocator));
+	}
+
+	void Scope::DestroyPair(TablePair* pair)
+	{
+		pair->~TablePair();
+		mAllocator->Deallocate(pair, sizeof(TablePair));
+	}
+
+	void Scope::DestroyChildren(Datum& datum)
+	{
+		if (datum.Type() == Datum::DatumType::Table)
+		{
+			for (std::uint32_t i = datum.Size(); i > 0; --i)
+			{
+				Scope* scope = datum.Get<Scope*>(i - 1);
+				if (scope != nullptr && scope->mParent == this)
+				{
+					// The whole entry is about to go, so the child does not need to find and remove itself
+					scope->mParent = nullptr;
+					delete scope;
+				}
+			}
+		}
+	}
+
+	void Scope::TakeOver(Scope& rhs)
+	{
+		// The entries have already been moved; the children they hold still point at the old scope
+		for (const auto& pair : mOrderedData)
+		{
+			Datum& datum = pair->second;
+			if (datum.Type() == Datum::DatumType::Table)
+			{
+				for (std::uint32_t i = 0; i < datum.Size(); ++i)
+				{
+					Scope* scope = datum.Get<Scope*>(i);
+					if (scope != nullptr && scope->mParent == &rhs)
+					{
+						scope->mParent = this;
+					}
+				}
+			}
+		}
+
+		// The old scope's parent owns the object in its slot, not the entries, so that place is never passed on
+		// and this scope keeps its own. Like Orphan(), leaving the parent makes the caller responsible for the old scope.
+		rhs.Orphan();
+
+		// Anything cached against the old scope's entries is no longer valid
+		++rhs.mRevision;
+	}
+
 #pragma endregion
 
 }
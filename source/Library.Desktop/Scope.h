@@ -15,6 +15,86 @@ namespace Library
 	{
 		RTTI_DECLARATIONS(Scope, RTTI)
 	public:
+		/**
+		 * @brief Routes the Scopes created on the current thread to an Allocator.
+		 *
+		 * While a guard is alive, every Scope created with new on its thread takes its own memory
+		 * and the memory for its entries from the guard's Allocator. Guards can be nested; the
+		 * previous Allocator is restored when a guard is destroyed.
+		 */
+		class AllocatorGuard final
+		{
+		public:
+			/**
+			 * Makes the given Allocator current for the calling thread.
+			 *
+			 * @param allocator the Allocator new Scopes should come from
+			 */
+			explicit AllocatorGuard(Allocator& allocator);
+
+			AllocatorGuard(const AllocatorGuard& rhs) = delete;
+			AllocatorGuard& operator=(const AllocatorGuard& rhs) = delete;
+
+			/**
+			 * Restores the Allocator that was current before the guard was created.
+			 */
+			~AllocatorGuard();
+
+		private:
+			Allocator* mPreviousAllocator;		/**< The Allocator to restore */
+		};
+
+		/**
+		 * Allocates a Scope from the calling thread's current Allocator. The Allocator is
+		 * recorded with the Scope so that delete gives the memory back to the right place.
+		 *
+		 * @param size the size of the Scope, in bytes
+		 * @return the address of the memory for the Scope
+		 */
+		static void* operator new(std::size_t size);
+
+		/**
+		 * Returns the memory of a Scope to the Allocator it came from.
+		 *
+		 * @param memory the address of the Scope
+		 */
+		static void operator delete(void* memory);
+
+		/**
+		 * Allocates a Scope from the calling thread's current Allocator, returning nullptr
+		 * rather than throwing if the Allocator is out of memory.
+		 *
+		 * @param size the size of the Scope, in bytes
+		 * @return the address of the memory for the Scope, or nullptr
+		 */
+		static void* operator new(std::size_t size, const std::nothrow_t&) noexcept;
+
+		/**
+		 * Returns the memory of a Scope allocated with the nothrow form of new, should its
+		 * constructor throw.
+		 *
+		 * @param memory the address of the Scope
+		 */
+		static void operator delete(void* memory, const std::nothrow_t&);
+
+		/**
+		 * Constructs a Scope in memory the caller already owns, as containers do. Declaring the
+		 * allocating forms above hides the global placement form, so it is forwarded here.
+		 *
+		 * @param size the size of the Scope, in bytes
+		 * @param memory the memory to construct the Scope in
+		 * @return memory
+		 */
+		static void* operator new(std::size_t size, void* memory) noexcept;
+
+		/**
+		 * Matches the placement form of new; the memory stays with the caller.
+		 *
+		 * @param memory the address of the Scope
+		 * @param place the memory the Scope was constructed in
+		 */
+		static void operator delete(void* memory, void* place);
+
 		/**
 		 * Default constructor.
 		 *
@@ -29,6 +109,15 @@ namespace Library
 		 */
 		Scope(const Scope& rhs);
 
+		/**
+		 * Move constructor. Takes over the entries and Allocator of the other scope and adopts its children.
+		 * The new scope has no parent. The other scope is left empty and is orphaned, so if it had a parent
+		 * the caller becomes responsible for deleting it, as with Orphan().
+		 *
+		 * @param rhs the other scope to move from
+		 */
+		Scope(Scope&& rhs);
+
 		/**
 		 * Assignment operator.
 		 *
@@ -37,6 +126,16 @@ namespace Library
 		 */
 		Scope& operator=(const Scope& rhs);
 
+		/**
+		 * Move assignment operator. Clears this scope, then takes over the entries, Allocator and children
+		 * of the other scope. This scope keeps its own place in the hierarchy. The other scope is left empty
+		 * and is orphaned, so if it had a parent the caller becomes responsible for deleting it, as with Orphan().
+		 *
+		 * @param rhs the other scope to move from
+		 * @return a reference to this scope
+		 */
+		Scope& operator=(Scope&& rhs);
+
 		/**
 		 * Equal comparison operator.
 		 *
@@ -70,13 +169,23 @@ namespace Library
 		 */
 		Datum& operator[](const std::uint32_t index);
 
+		/**
+		 * Returns the name of the Datum at the given index. The index values correspond to the
+		 * order in which items were appended.
+		 *
+		 * @param index the index of the Datum
+		 * @return the name the Datum was appended with
+		 */
+		const Symbol& NameAt(const std::uint32_t index) const;
+
 		/**
 		 * Deconstructor.
 		 */
 		virtual ~Scope();
 
 		/**
-		 * Deletes all memory allocated by this object.
+		 * Deletes all memory allocated by this object. Children are destroyed without orphaning
+		 * themselves, since the entries that hold them are going away anyway.
 		 *
 		 * @param skipOrphan optional parameter that skips orphaning 
 		 * when set to true
@@ -84,7 +193,9 @@ namespace Library
 		void Clear(const bool skipOrphan = false);
 
 		/**
-		 * Breaks the link between parent and child scopes.
+		 * Breaks the link between parent and child scopes. The scope remembers which slot of its
+		 * parent holds it, so this takes constant time; the last scope in the same table Datum is
+		 * moved into the freed slot.
 		 */
 		void Orphan();
 
@@ -97,6 +208,25 @@ namespace Library
 		 */
 		Datum* Find(const std::string& name) const;
 
+		/**
+		 * Returns the address of the Datum associated with the given name in this Scope, if it 
+		 * exists, and nullptr otherwise. Looks the name up without constructing a std::string.
+		 *
+		 * @param name the name associated with the datum
+		 * @return an address to the datum with the associated name in the scope
+		 */
+		Datum* Find(const char* name) const;
+
+		/**
+		 * Returns the address of the Datum associated with the given Symbol in this Scope, if it 
+		 * exists, and nullptr otherwise. This is the fastest lookup: it hashes an integer and 
+		 * compares pointers.
+		 *
+		 * @param name the interned name associated with the datum
+		 * @return an address to the datum with the associated name in the scope
+		 */
+		Datum* Find(const Symbol& name) const;
+
 		/**
 		 * Takes a constant string and an optional address of a Scope double pointer
 		 * which returns the address of a Datum. This should return the address of 
@@ -109,6 +239,26 @@ namespace Library
 		 */
 		Datum* Search(const std::string& name, Scope** scope = nullptr) const;
 
+		/**
+		 * Searches this Scope and its ancestors for the most-closely nested Datum with the given 
+		 * name, without constructing a std::string.
+		 *
+		 * @param name the name to search for
+		 * @param scope contains the address of the Scope object which contains the match
+		 * @return the found Datum
+		 */
+		Datum* Search(const char* name, Scope** scope = nullptr) const;
+
+		/**
+		 * Searches this Scope and its ancestors for the most-closely nested Datum with the given 
+		 * interned name.
+		 *
+		 * @param name the interned name to search for
+		 * @param scope contains the address of the Scope object which contains the match
+		 * @return the found Datum
+		 */
+		Datum* Search(const Symbol& name, Scope** scope = nullptr) const;
+
 		/**
 		 * Return a reference to a Datum with the associated name.
 		 *
@@ -117,6 +267,14 @@ namespace Library
 		 */
 		Datum& Append(const std::string& name);
 
+		/**
+		 * Return a reference to a Datum with the associated interned name.
+		 *
+		 * @param name the interned name to append
+		 * @return a reference to a Datum with the associated name
+		 */
+		Datum& Append(const Symbol& name);
+
 		/**
 		 * Returns a reference to a Scope with the associated name.
 		 * 
@@ -126,7 +284,15 @@ namespace Library
 		Scope& AppendScope(const std::string& name);
 
 		/**
-		 * Places a child into a table with a given name.
+		 * Returns a reference to a Scope with the associated interned name.
+		 * 
+		 * @param name the interned name to search for
+		 * @return the address of the scope 
+		 */
+		Scope& AppendScope(const Symbol& name);
+
+		/**
+		 * Places a child into a table with a given name, orphaning it from its previous parent first.
 		 *
 		 * @param child the child scope
 		 * @param childName the name of the child
@@ -173,13 +339,64 @@ namespace Library
 		 * @return the size of the order vector
 		 */
 		std::uint32_t Size() const;
+
+		/**
+		 * Returns the revision of the Scope's layout. The revision changes whenever entries are
+		 * removed from the Scope, which is the only time a previously found Datum address becomes
+		 * invalid, so a cached Datum* is still good for as long as the revision it was found at is current.
+		 *
+		 * @return the revision of the Scope's layout
+		 */
+		std::uint32_t Revision() const;
+
+		/**
+		 * Returns the Allocator this Scope's entries come from. Children created through
+		 * AppendScope come from the same Allocator.
+		 *
+		 * @return a reference to the Allocator
+		 */
+		Allocator& GetAllocator() const;
 	protected:
-		typedef std::pair<std::string, Datum> TablePair;
+		typedef std::pair<Symbol, Datum> TablePair;
+
+		/**
+		 * Removes the entries from the given index on, destroying the child scopes they hold.
+		 * The entries before the index keep their addresses.
+		 *
+		 * @param size the number of entries to keep
+		 */
+		void Truncate(const std::uint32_t size);
+
+		/**
+		 * Returns the Allocator Scopes created on the calling thread come from.
+		 *
+		 * @return the Allocator of the innermost AllocatorGuard, or the default Allocator
+		 */
+		static Allocator& CurrentAllocator();
 	private:
+		struct alignas(std::max_align_t) AllocationHeader
+		{
+			Allocator* mAllocator;				/**< The Allocator the Scope came from */
+			std::size_t mSize;					/**< The size the Scope was allocated with */
+		};
+
+		void TakeOver(Scope& rhs);
+		void SetParent(Scope& parent, Datum& datum, const std::uint32_t index);
+		bool FindSlot(const Scope& child, Datum*& datum, std::uint32_t& index) const;
+		TablePair* CreatePair(const Symbol& name);
+		void DestroyPair(TablePair* pair);
+		void DestroyChildren(Datum& datum);
+
+		static thread_local Allocator* sCurrentAllocator;
+
 		const std::uint32_t DefaultNumberOfBuckets = 10;
-		HashMap<std::string, Datum> mData;
-		Vector<TablePair*> mOrderedData;
+		Allocator* mAllocator;							/**< Where the entries and their values come from */
+		HashMap<Symbol, TablePair*> mData;			/**< Maps a name to its entry; entries are heap allocated so Datum addresses stay stable */
+		Vector<TablePair*> mOrderedData;				/**< The entries in the order they were appended */
 		Scope* mParent;
+		Datum* mParentDatum;							/**< The table Datum in the parent that holds this scope */
+		std::uint32_t mParentIndex;						/**< The index of this scope in mParentDatum */
+		std::uint32_t mRevision;						/**< Incremented whenever entries are removed */
 	};
 
 }
@@ -4,12 +4,15 @@ namespace Library
 {
 	RTTI_DEFINITIONS(Sector)
 
+	const Symbol Sector::sEntitiesName("entities");
+
 	Sector::Sector()
 		: mName(), mWorld(nullptr)
 	{
 		AddExternalSignature("name", 1, &mName);
 		CreateTableDatum("entities");
 		Populate();
+		Entities();
 	}
 
 	Sector::Sector(const std::string& name)
@@ -18,6 +21,28 @@ namespace Library
 		AddExternalSignature("name", 1, &mName);
 		CreateTableDatum("entities");
 		Populate();
+		Entities();
+	}
+
+	Sector::Sector(Sector&& rhs)
+		: Attributed(std::move(rhs)), mName(std::move(rhs.mName)), mWorld(rhs.mWorld), mEntities()
+	{
+		MoveExternalStorage(rhs, sizeof(Sector));
+		rhs.mWorld = nullptr;
+	}
+
+	Sector& Sector::operator=(Sector&& rhs)
+	{
+		if (this != &rhs)
+		{
+			Attributed::operator=(std::move(rhs));
+			mName = std::move(rhs.mName);
+			mWorld = rhs.mWorld;
+			MoveExternalStorage(rhs, sizeof(Sector));
+			rhs.mWorld = nullptr;
+		}
+
+		return *this;
 	}
 
 	const std::string& Sector::Name() const
@@ -32,13 +57,12 @@ namespace Library
 
 	Datum& Sector::Entities()
 	{
-		Datum* foundEntities = Find("entities");
-		assert(foundEntities != nullptr);
-		return *foundEntities;
+		return FindCached(sEntitiesName, mEntities);
 	}
 
 	Entity& Sector::CreateEntity(const std::string& className, const std::string& instanceName)
 	{
+		AllocatorGuard guard(GetAllocator());
 		RTTI* rtti = Factory<RTTI>::Create(className);
 		if (rtti == nullptr)
 		{
@@ -89,4 +113,54 @@ namespace Library
 		state.entity = nullptr;
 	}
 
+	void Sector::Update(WorldState& state, JobSystem& jobSystem, const std::uint32_t entitiesPerJob)
+	{
+		// The arena is a LinearAllocator, which is not thread-safe, so its Entities are updated one at a time
+		World* world = GetWorld();
+		if (world != nullptr && world->Arena() != nullptr)
+		{
+			Update(state);
+			return;
+		}
+
+		// Entities with Actions that are not parallel-safe are picked out during the parallel pass, so each Entity is only checked once
+		Datum& cachedEntities = Entities();
+		std::mutex serialMutex;
+		std::vector<std::uint32_t> serialEntities;
+		jobSystem.ParallelFor(cachedEntities.Size(), entitiesPerJob, [this, &state, &cachedEntities, &serialMutex, &serialEntities](std::uint32_t begin, std::uint32_t end)
+		{
+			WorldState jobState(state.GetGameTime());
+			jobState.world = state.world;
+			jobState.sector = this;
+
+			for (std::uint32_t i = begin; i < end; ++i)
+			{
+				Entity* entity = cachedEntities[i].As<Entity>();
+				assert(entity != nullptr);
+
+				if (entity->IsParallelSafe())
+				{
+					jobState.entity = entity;
+					entity->Update(jobState);
+				}
+				else
+				{
+					std::lock_guard<std::mutex> lock(serialMutex);
+					serialEntities.push_back(i);
+				}
+			}
+		});
+
+		// They wait for the parallel ones to finish, then run in the order they appear in the Sector
+		std::sort(serialEntities.begin(), serialEntities.end());
+		for (std::uint32_t i : serialEntities)
+		{
+			Entity* entity = cachedEntities[i].As<Entity>();
+			state.entity = entity;
+			entity->Update(state);
+		}
+
+		state.entity = nullptr;
+	}
+
 }
@@ -4,6 +4,7 @@
 
 namespace Library
 {
+	class JobSystem;
 	class World;
 	class WorldState;
 
@@ -28,6 +29,36 @@ namespace Library
 		 */
 		Sector(const std::string& name);
 
+		/**
+		 * Copy constructor.
+		 *
+		 * @param rhs the Sector to copy from
+		 */
+		Sector(const Sector& rhs) = default;
+
+		/**
+		 * Move a Sector. Its Entities are re-parented to the new Sector.
+		 *
+		 * @param rhs the Sector to move from
+		 */
+		Sector(Sector&& rhs);
+
+		/**
+		 * Assignment operator.
+		 *
+		 * @param rhs the Sector to copy from
+		 * @return a reference to this Sector
+		 */
+		Sector& operator=(const Sector& rhs) = default;
+
+		/**
+		 * Move a Sector. Its Entities are re-parented to this Sector.
+		 *
+		 * @param rhs the Sector to move from
+		 * @return a reference to this Sector
+		 */
+		Sector& operator=(Sector&& rhs);
+
 		/**
 		 * Default deconstructor.
 		 */
@@ -84,8 +115,32 @@ namespace Library
 		 */
 		void Update(WorldState& state);
 
+		/**
+		 * Updates the Entities on a JobSystem. Parallel-safe Entities are split into chunks that
+		 * run at the same time, each with a WorldState of its own; the rest are then updated one
+		 * at a time on the calling thread with the given WorldState. The Entities of a World that
+		 * allocates from an arena are all updated on the calling thread, since the arena is not
+		 * thread-safe.
+		 *
+		 * Unlike Update(WorldState&), this does not update the Entities in Sector order. Every
+		 * parallel-safe Entity is updated before any Entity that is not, and the parallel-safe
+		 * ones are updated in no particular order. The Entities that are not parallel-safe are
+		 * updated in Sector order, after all the others have finished. An arena World's Entities
+		 * are updated in Sector order.
+		 *
+		 * @param state the state of the world
+		 * @param jobSystem the JobSystem to run the chunks on
+		 * @param entitiesPerJob the largest number of Entities updated by one job
+		 */
+		void Update(WorldState& state, JobSystem& jobSystem, const std::uint32_t entitiesPerJob = DefaultEntitiesPerJob);
+
+		static const std::uint32_t DefaultEntitiesPerJob = 64;		/**< The number of Entities in a job when none is given */
+
 	private:
 		std::string mName;			/**< Name of the Sector */
 		World* mWorld;				/**< The World this Sector belongs to */
+		CachedAttribute mEntities;	/**< The resolved "entities" Datum */
+
+		static const Symbol sEntitiesName;
 	};
 }
@@ -0,0 +1,78 @@
+#pragma once
+
+#include <cstdint>
+
+namespace Library
+{
+	/**
+	 * A non-owning view over a contiguous array of elements. A Span is cheap to copy and
+	 * does not check bounds outside of debug builds, so it is meant for tight loops over
+	 * storage that has already been validated, such as the values of a Datum.
+	 */
+	template<typename T>
+	class Span
+	{
+	public:
+		/**
+		 * Default constructor. Creates an empty Span.
+		 */
+		Span();
+
+		/**
+		 * Constructs a Span over an array.
+		 *
+		 * @param data the address of the first element
+		 * @param size the number of elements
+		 */
+		Span(T* data, const std::uint32_t size);
+
+		/**
+		 * Returns the element at a given index.
+		 *
+		 * @param index the index of the element
+		 * @return a reference to the element
+		 */
+		T& operator[](const std::uint32_t index) const;
+
+		/**
+		 * Returns the address of the first element.
+		 *
+		 * @return the address of the first element, or nullptr for an empty Span
+		 */
+		T* Data() const;
+
+		/**
+		 * Returns the number of elements in the Span.
+		 *
+		 * @return the number of elements
+		 */
+		std::uint32_t Size() const;
+
+		/**
+		 * Returns whether the Span has no elements.
+		 *
+		 * @return true if the Span is empty, false otherwise
+		 */
+		bool IsEmpty() const;
+
+		/**
+		 * Returns the address of the first element, for range-based for loops.
+		 *
+		 * @return the address of the first element
+		 */
+		T* begin() const;
+
+		/**
+		 * Returns the address one past the last element, for range-based for loops.
+		 *
+		 * @return the address one past the last element
+		 */
+		T* end() const;
+
+	private:
+		T* mData;					/**< The first element of the viewed array */
+		std::uint32_t mSize;		/**< The number of elements in the viewed array */
+	};
+}
+
+#include "Span.inl"
@@ -0,0 +1,53 @@
+#include "pch.h"
+
+namespace Library
+{
+	template<typename T>
+	Span<T>::Span() :
+		mData(nullptr), mSize(0)
+	{
+	}
+
+	template<typename T>
+	Span<T>::Span(T* data, const std::uint32_t size) :
+		mData(data), mSize(size)
+	{
+	}
+
+	template<typename T>
+	inline T& Span<T>::operator[](const std::uint32_t index) const
+	{
+		assert(index < mSize);
+		return mData[index];
+	}
+
+	template<typename T>
+	inline T* Span<T>::Data() const
+	{
+		return mData;
+	}
+
+	template<typename T>
+	inline std::uint32_t Span<T>::Size() const
+	{
+		return mSize;
+	}
+
+	template<typename T>
+	inline bool Span<T>::IsEmpty() const
+	{
+		return (mSize == 0);
+	}
+
+	template<typename T>
+	inline T* Span<T>::begin() const
+	{
+		return mData;
+	}
+
+	template<typename T>
+	inline T* Span<T>::end() const
+	{
+		return mData + mSize;
+	}
+}
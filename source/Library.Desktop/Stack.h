@@ -14,8 +14,10 @@ namespace Library
 
 		/**
 		 * Default constructor.
+		 *
+		 * @param allocator the Allocator the Stack's items come from
 		 */
-		Stack() = default;
+		explicit Stack(Allocator& allocator = Allocator::Default());
 
 		/**
 		 * Copy constructor.
@@ -3,6 +3,12 @@
 namespace Library
 {
 
+	template<typename T>
+	Stack<T>::Stack(Allocator& allocator) :
+		mVector(0, false, allocator)
+	{
+	}
+
 	template<typename T>
 	Stack<T>::Stack(const Stack& rhs) :
 		mVector(rhs.mVector)
@@ -0,0 +1,46 @@
+#include "pch.h"
+
+namespace Library
+{
+	SubscriberList::Snapshot SubscriberList::GetSnapshot() const
+	{
+		return std::atomic_load(&mSnapshot);
+	}
+
+	void SubscriberList::Add(IEventSubscriber& subscriber)
+	{
+		std::lock_guard<std::mutex> lock(mWriteMutex);
+		Subscribers subscribers(mSnapshot != nullptr ? *mSnapshot : Subscribers());
+		subscribers.PushBack(&subscriber);
+		Publish(std::move(subscribers));
+	}
+
+	void SubscriberList::Remove(IEventSubscriber& subscriber)
+	{
+		std::lock_guard<std::mutex> lock(mWriteMutex);
+		if (mSnapshot != nullptr)
+		{
+			Subscribers subscribers(*mSnapshot);
+			subscribers.Remove(&subscriber);
+			Publish(std::move(subscribers));
+		}
+	}
+
+	void SubscriberList::Clear()
+	{
+		std::lock_guard<std::mutex> lock(mWriteMutex);
+		std::atomic_store(&mSnapshot, Snapshot());
+	}
+
+	std::uint32_t SubscriberList::Size() const
+	{
+		Snapshot snapshot = GetSnapshot();
+		return (snapshot != nullptr ? snapshot->Size() : 0);
+	}
+
+	void SubscriberList::Publish(Subscribers&& subscribers)
+	{
+		// Only writers touch mSnapshot without an atomic load, and they hold mWriteMutex
+		std::atomic_store(&mSnapshot, Snapshot(std::make_shared<Subscribers>(std::move(subscribers))));
+	}
+}
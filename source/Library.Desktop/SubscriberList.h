@@ -0,0 +1,79 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include "Vector.h"
+
+namespace Library
+{
+	class IEventSubscriber;
+
+	/**
+	 * The subscribers of one event type, published as immutable snapshots. Delivering an event
+	 * takes the current snapshot and notifies it without holding any lock, so deliveries on
+	 * different threads never wait on each other. Adding or removing a subscriber copies the
+	 * current snapshot, changes the copy and swaps it in; deliveries already under way finish
+	 * with the snapshot they took, and it is freed once the last of them lets go of it.
+	 */
+	class SubscriberList final
+	{
+	public:
+		typedef Vector<IEventSubscriber*> Subscribers;
+		typedef std::shared_ptr<const Subscribers> Snapshot;
+
+		/**
+		 * Default constructor. The list starts out empty without allocating anything, so it can be
+		 * used before dynamic initialization has run.
+		 */
+		SubscriberList() = default;
+
+		// Publishers refer to the list they were created with, so it cannot be copied
+		SubscriberList(const SubscriberList& rhs) = delete;
+		SubscriberList& operator=(const SubscriberList& rhs) = delete;
+
+		/**
+		 * Default deconstructor.
+		 */
+		~SubscriberList() = default;
+
+		/**
+		 * Returns the current subscribers. The snapshot never changes, however the list changes later.
+		 *
+		 * @return the current snapshot, or nullptr if there have never been any subscribers
+		 */
+		Snapshot GetSnapshot() const;
+
+		/**
+		 * Adds a subscriber.
+		 *
+		 * @param subscriber the subscriber to add
+		 */
+		void Add(IEventSubscriber& subscriber);
+
+		/**
+		 * Removes a subscriber.
+		 *
+		 * @param subscriber the subscriber to remove
+		 */
+		void Remove(IEventSubscriber& subscriber);
+
+		/**
+		 * Removes every subscriber.
+		 */
+		void Clear();
+
+		/**
+		 * Returns the number of subscribers in the current snapshot.
+		 *
+		 * @return the number of subscribers
+		 */
+		std::uint32_t Size() const;
+
+	private:
+		void Publish(Subscribers&& subscribers);
+
+		Snapshot mSnapshot;				/**< The current subscribers, only read and written atomically */
+		std::mutex mWriteMutex;			/**< Serializes the changes, so none of them is lost */
+	};
+}
@@ -0,0 +1,214 @@
+#include "pch.h"
+
+namespace Library
+{
+	/**
+	 * The global table of interned names: an open-addressed array of entry pointers that is only
+	 * ever added to. Readers probe whichever array is current without taking a lock; writers take
+	 * the write mutex, fill an empty slot, and when the array gets too full they rehash into one
+	 * twice the size and publish it. A retired array is never freed, since a reader may still be
+	 * probing it, which costs at most as much again as the current array.
+	 */
+	struct Symbol::Table
+	{
+		struct Slots
+		{
+			explicit Slots(std::uint32_t capacity) :
+				mCapacity(capacity), mEntries(new std::atomic<Entry*>[capacity])
+			{
+				for (std::uint32_t i = 0; i < mCapacity; ++i)
+				{
+					mEntries[i].store(nullptr, std::memory_order_relaxed);
+				}
+			}
+
+			std::uint32_t mCapacity;				/**< The number of slots, always a power of two */
+			std::atomic<Entry*>* mEntries;			/**< The slots, nullptr where no entry has been placed */
+		};
+
+		Table() :
+			mSlots(new Slots(DefaultCapacity)), mCount(0), mNextId(0)
+		{
+		}
+
+		static std::uint32_t Hash(const std::string& name)
+		{
+			return HashBytes(name.data(), name.length());
+		}
+
+		static std::uint32_t Hash(const char* name)
+		{
+			return HashBytes(name, std::strlen(name));
+		}
+
+		template<typename TName>
+		static Entry* Find(const Slots& slots, std::uint32_t hash, const TName& name)
+		{
+			const std::uint32_t mask = slots.mCapacity - 1;
+			for (std::uint32_t index = hash & mask; ; index = (index + 1) & mask)
+			{
+				Entry* entry = slots.mEntries[index].load(std::memory_order_acquire);
+				if ((entry == nullptr) || ((entry->mHash == hash) && (entry->mName == name)))
+				{
+					return entry;
+				}
+			}
+		}
+
+		static void Place(Slots& slots, Entry* entry)
+		{
+			const std::uint32_t mask = slots.mCapacity - 1;
+			std::uint32_t index = entry->mHash & mask;
+			while (slots.mEntries[index].load(std::memory_order_relaxed) != nullptr)
+			{
+				index = (index + 1) & mask;
+			}
+
+			// Release, so a reader that finds the entry also sees its name, id and hash
+			slots.mEntries[index].store(entry, std::memory_order_release);
+		}
+
+		/**
+		 * Adds a new entry to the table, growing it first if it would end up more than three
+		 * quarters full, which keeps probes short and guarantees they reach an empty slot. Must be
+		 * called with the write mutex held.
+		 *
+		 * @param entry the entry to add
+		 */
+		void Insert(Entry* entry)
+		{
+			Slots* slots = mSlots.load(std::memory_order_relaxed);
+			const std::uint32_t count = mCount.load(std::memory_order_relaxed) + 1;
+			if (count > (slots->mCapacity / 4) * 3)
+			{
+				Slots* grown = new Slots(slots->mCapacity * 2);
+				for (std::uint32_t i = 0; i < slots->mCapacity; ++i)
+				{
+					Entry* existing = slots->mEntries[i].load(std::memory_order_relaxed);
+					if (existing != nullptr)
+					{
+						Place(*grown, existing);
+					}
+				}
+
+				mSlots.store(grown, std::memory_order_release);
+				slots = grown;
+			}
+
+			Place(*slots, entry);
+			mCount.store(count, std::memory_order_release);
+		}
+
+		static const std::uint32_t DefaultCapacity = 1024;
+
+		std::atomic<Slots*> mSlots;				/**< The current array, swapped for a larger one as names are added */
+		std::atomic<std::uint32_t> mCount;		/**< The number of interned names */
+		std::mutex mWriteMutex;					/**< Serializes interning new names */
+		std::uint32_t mNextId;					/**< The id of the most recently interned name */
+	};
+
+	Symbol::Symbol() :
+		mEntry(nullptr)
+	{
+	}
+
+	Symbol::Symbol(const std::string& name) :
+		Symbol(Intern(name))
+	{
+	}
+
+	Symbol::Symbol(const char* name) :
+		Symbol((name == nullptr) ? Symbol() : Intern(name))
+	{
+	}
+
+	Symbol::Symbol(Entry* entry) :
+		mEntry(entry)
+	{
+	}
+
+	bool Symbol::operator==(const Symbol& other) const
+	{
+		return (mEntry == other.mEntry);
+	}
+
+	bool Symbol::operator!=(const Symbol& other) const
+	{
+		return !(operator==(other));
+	}
+
+	const std::string& Symbol::Name() const
+	{
+		static const std::string EmptyName;
+		return (mEntry != nullptr ? mEntry->mName : EmptyName);
+	}
+
+	std::uint32_t Symbol::Id() const
+	{
+		return (mEntry != nullptr ? mEntry->mId : 0U);
+	}
+
+	bool Symbol::IsEmpty() const
+	{
+		return (mEntry == nullptr);
+	}
+
+	Symbol Symbol::Find(const std::string& name)
+	{
+		return Lookup(name);
+	}
+
+	Symbol Symbol::Find(const char* name)
+	{
+		return ((name == nullptr) ? Symbol() : Lookup(name));
+	}
+
+	std::uint32_t Symbol::Count()
+	{
+		return GetTable().mCount.load(std::memory_order_acquire);
+	}
+
+	Symbol::Table& Symbol::GetTable()
+	{
+		// Constructed on first use so that Symbols can safely be created during static initialization
+		static Table table;
+		return table;
+	}
+
+	template<typename TName>
+	Symbol Symbol::Intern(const TName& name)
+	{
+		if (name[0] == '\0')
+		{
+			return Symbol();
+		}
+
+		Table& table = GetTable();
+		const std::uint32_t hash = Table::Hash(name);
+		Entry* entry = Table::Find(*table.mSlots.load(std::memory_order_acquire), hash, name);
+		if (entry == nullptr)
+		{
+			std::lock_guard<std::mutex> lock(table.mWriteMutex);
+
+			// Another thread may have interned the name while we were waiting for the lock
+			entry = Table::Find(*table.mSlots.load(std::memory_order_relaxed), hash, name);
+			if (entry == nullptr)
+			{
+				entry = new Entry();
+				entry->mName = name;
+				entry->mId = ++table.mNextId;
+				entry->mHash = hash;
+				table.Insert(entry);
+			}
+		}
+
+		return Symbol(entry);
+	}
+
+	template<typename TName>
+	Symbol Symbol::Lookup(const TName& name)
+	{
+		const Table& table = GetTable();
+		return Symbol(Table::Find(*table.mSlots.load(std::memory_order_acquire), Table::Hash(name), name));
+	}
+}
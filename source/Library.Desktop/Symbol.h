@@ -0,0 +1,170 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include "HashMap.h"
+
+namespace Library
+{
+	/**
+	 * A Symbol is an interned name. Every Symbol created from the same string refers to the same
+	 * shared entry in a global, thread-safe symbol table, so comparing two Symbols is a pointer
+	 * comparison and hashing one is integer hashing. Entries are never released, so a Symbol is a
+	 * plain pointer that is copied without touching shared state, and looking up a name that has
+	 * already been interned takes no lock.
+	 */
+	class Symbol final
+	{
+	public:
+		/**
+		 * Default constructor. Creates an empty Symbol that does not refer to any name.
+		 */
+		Symbol();
+
+		/**
+		 * Interns the given name and returns its Symbol. An empty name produces an empty Symbol.
+		 *
+		 * @param name the name to intern
+		 */
+		explicit Symbol(const std::string& name);
+
+		/**
+		 * Interns the given name and returns its Symbol. An empty name produces an empty Symbol.
+		 *
+		 * @param name the name to intern
+		 */
+		explicit Symbol(const char* name);
+
+		/**
+		 * Copy constructor.
+		 *
+		 * @param rhs the Symbol to copy
+		 */
+		Symbol(const Symbol& rhs) = default;
+
+		/**
+		 * Move constructor.
+		 *
+		 * @param rhs the Symbol to move
+		 */
+		Symbol(Symbol&& rhs) = default;
+
+		/**
+		 * Assignment operator.
+		 *
+		 * @param rhs the Symbol to copy
+		 * @return a reference to this Symbol
+		 */
+		Symbol& operator=(const Symbol& rhs) = default;
+
+		/**
+		 * Move assignment operator.
+		 *
+		 * @param rhs the Symbol to move
+		 * @return a reference to this Symbol
+		 */
+		Symbol& operator=(Symbol&& rhs) = default;
+
+		/**
+		 * Default destructor. The table entry outlives every Symbol that refers to it.
+		 */
+		~Symbol() = default;
+
+		/**
+		 * Two Symbols are equal when they were interned from the same name.
+		 *
+		 * @param other the Symbol to compare against
+		 * @return true if both Symbols refer to the same name, false otherwise
+		 */
+		bool operator==(const Symbol& other) const;
+
+		/**
+		 * Two Symbols are not equal when they were interned from different names.
+		 *
+		 * @param other the Symbol to compare against
+		 * @return true if the Symbols refer to different names, false otherwise
+		 */
+		bool operator!=(const Symbol& other) const;
+
+		/**
+		 * Returns the interned name.
+		 *
+		 * @return the interned name, or an empty string for an empty Symbol
+		 */
+		const std::string& Name() const;
+
+		/**
+		 * Returns the id of the interned name. Ids are never reused while the program runs.
+		 *
+		 * @return the id of the name, or zero for an empty Symbol
+		 */
+		std::uint32_t Id() const;
+
+		/**
+		 * Returns whether this Symbol refers to a name.
+		 *
+		 * @return true if the Symbol refers to a name, false if it is empty
+		 */
+		bool IsEmpty() const;
+
+		/**
+		 * Returns the Symbol for a name that has already been interned, without interning it.
+		 *
+		 * @param name the name to look up
+		 * @return the Symbol for the name, or an empty Symbol if the name has never been interned
+		 */
+		static Symbol Find(const std::string& name);
+
+		/**
+		 * Returns the Symbol for a name that has already been interned, without interning it.
+		 *
+		 * @param name the name to look up
+		 * @return the Symbol for the name, or an empty Symbol if the name has never been interned
+		 */
+		static Symbol Find(const char* name);
+
+		/**
+		 * Returns the number of distinct names interned so far.
+		 *
+		 * @return the number of interned names
+		 */
+		static std::uint32_t Count();
+
+	private:
+		struct Entry
+		{
+			std::string mName;			/**< The interned name */
+			std::uint32_t mId;			/**< The id handed out when the name was interned */
+			std::uint32_t mHash;		/**< The hash of the name, so probing rarely compares strings */
+		};
+
+		struct Table;
+
+		explicit Symbol(Entry* entry);
+		static Table& GetTable();
+		template<typename TName> static Symbol Intern(const TName& name);
+		template<typename TName> static Symbol Lookup(const TName& name);
+
+		Entry* mEntry;
+	};
+
+	/**
+	 * @brief Hashes a Symbol by its id. The HashMap scrambles the bits itself, so sequential
+	 * ids still spread evenly over the buckets.
+	 */
+	template<>
+	class DefaultHash<Symbol>
+	{
+	public:
+		/**
+		 * Overloads operator() to return a hash index.
+		 *
+		 * @param key the key to hash
+		 * @return the hash of the key
+		 */
+		std::uint32_t operator()(const Symbol& key) const
+		{
+			return key.Id();
+		}
+	};
+}
@@ -0,0 +1,34 @@
+#include "pch.h"
+
+namespace Library
+{
+	void* SystemAllocator::DoAllocate(const std::size_t size)
+	{
+		void* memory = std::malloc(size);
+		if (memory == nullptr)
+		{
+			throw std::bad_alloc();
+		}
+
+		return memory;
+	}
+
+	void* SystemAllocator::DoReallocate(void* memory, const std::size_t oldSize, const std::size_t newSize)
+	{
+		UNREFERENCED_PARAMETER(oldSize);
+
+		void* newMemory = std::realloc(memory, newSize);
+		if (newMemory == nullptr)
+		{
+			throw std::bad_alloc();
+		}
+
+		return newMemory;
+	}
+
+	void SystemAllocator::DoDeallocate(void* memory, const std::size_t size)
+	{
+		UNREFERENCED_PARAMETER(size);
+		std::free(memory);
+	}
+}
@@ -0,0 +1,31 @@
+#pragma once
+
+#include "Allocator.h"
+
+namespace Library
+{
+	/**
+	 * @brief An Allocator that takes its memory straight from the heap.
+	 *
+	 * This is the Allocator containers use when none is given. It is thread-safe, and a
+	 * subsystem can create its own instance to keep track of how much heap memory it uses.
+	 */
+	class SystemAllocator final : public Allocator
+	{
+	public:
+		/**
+		 * Default constructor.
+		 */
+		SystemAllocator() = default;
+
+		/**
+		 * Default deconstructor.
+		 */
+		virtual ~SystemAllocator() = default;
+
+	protected:
+		virtual void* DoAllocate(const std::size_t size) override;
+		virtual void* DoReallocate(void* memory, const std::size_t oldSize, const std::size_t newSize) override;
+		virtual void DoDeallocate(void* memory, const std::size_t size) override;
+	};
+}
@@ -0,0 +1,153 @@
+#pragma once
+
+#include <cstdint>
+#include <chrono>
+
+namespace Library
+{
+	/**
+	 * A hierarchical timing wheel that hands out items once the time they expire has passed.
+	 *
+	 * Time is split into ticks of one millisecond. The wheel has Levels levels of SlotCount slots;
+	 * a slot on level 0 holds the items due on one tick, and a slot on level n covers SlotCount
+	 * times as many ticks as a slot on level n - 1. An item goes into the lowest level whose slots
+	 * can tell it apart from the current tick, and drops a level each time the wheel reaches the
+	 * start of its slot, so inserting is O(1) and expiring is O(1) amortized per item. Items due
+	 * more than SlotCount^Levels ticks ahead wait on an overflow list. The items live in a pool of
+	 * nodes linked into their slots, so nothing is allocated once the pool is large enough.
+	 * Items due on the same tick come out in no particular order.
+	 */
+	template<typename T>
+	class TimingWheel
+	{
+	public:
+		typedef std::chrono::high_resolution_clock::time_point TimePoint;
+
+		/**
+		 * Default constructor.
+		 *
+		 * @param allocator the Allocator the TimingWheel's nodes come from
+		 */
+		explicit TimingWheel(Allocator& allocator = Allocator::Default());
+
+		/**
+		 * Copy constructor.
+		 *
+		 * @param rhs the TimingWheel to copy from
+		 */
+		TimingWheel(const TimingWheel& rhs) = default;
+
+		/**
+		 * Move constructor. The other TimingWheel is left empty.
+		 *
+		 * @param rhs the TimingWheel to move from
+		 */
+		TimingWheel(TimingWheel&& rhs);
+
+		/**
+		 * Overloads the assignment operator.
+		 *
+		 * @param rhs the TimingWheel to assign from
+		 */
+		TimingWheel& operator=(const TimingWheel& rhs) = default;
+
+		/**
+		 * Move assignment operator. The other TimingWheel is left empty.
+		 *
+		 * @param rhs the TimingWheel to move from
+		 * @return a reference to this TimingWheel
+		 */
+		TimingWheel& operator=(TimingWheel&& rhs);
+
+		/**
+		 * Default deconstructor.
+		 */
+		~TimingWheel() = default;
+
+		/**
+		 * Adds an item to the TimingWheel.
+		 *
+		 * @param item the item to add
+		 * @param expiry when the item expires
+		 * @param currentTime the current time, which the wheel starts from when it is empty
+		 */
+		void Insert(const T& item, const TimePoint& expiry, const TimePoint& currentTime);
+
+		/**
+		 * Moves the wheel up to the current time and removes every item whose expiry time has passed.
+		 *
+		 * @param currentTime the current time
+		 * @param expire called with each expired item; it must not change the TimingWheel
+		 */
+		template<typename FunctionT>
+		void Advance(const TimePoint& currentTime, FunctionT expire);
+
+		/**
+		 * Returns when the soonest item expires.
+		 *
+		 * @return the expiry time of the soonest item, or TimePoint::max() if the TimingWheel is empty
+		 */
+		TimePoint NextExpiryTime() const;
+
+		/**
+		 * Calls a function with every item in the TimingWheel, in no particular order.
+		 *
+		 * @param function called with each item; it must not change the TimingWheel
+		 */
+		template<typename FunctionT>
+		void ForEach(FunctionT function) const;
+
+		/**
+		 * Returns the number of items in the TimingWheel.
+		 *
+		 * @return the number of items
+		 */
+		std::uint32_t Size() const;
+
+		/**
+		 * Returns whether the TimingWheel is empty.
+		 *
+		 * @return true if the TimingWheel is empty, false otherwise
+		 */
+		bool IsEmpty() const;
+
+		/**
+		 * Removes every item from the TimingWheel.
+		 */
+		void Clear();
+
+		static const std::uint32_t Levels = 4;					/**< The number of levels */
+		static const std::uint32_t SlotBits = 8;				/**< The number of tick bits each level covers */
+		static const std::uint32_t SlotCount = 1 << SlotBits;	/**< The number of slots on each level */
+		static const std::uint32_t DefaultCapacity = 64;		/**< The number of nodes reserved by the first Insert */
+
+	private:
+		struct Node
+		{
+			T mItem;						/**< The item */
+			TimePoint mExpiry;				/**< When the item expires */
+			std::uint64_t mTick;			/**< The tick the item expires on */
+			std::uint32_t mNext;			/**< The next node in the same slot */
+		};
+
+		void Place(const std::uint32_t index);
+		void Cascade(const std::uint64_t tick);
+		std::uint64_t NextTick(const std::uint64_t tick) const;
+		void ResetSlots();
+		std::uint32_t& Slot(const std::uint32_t level, const std::uint64_t tick);
+		static std::uint64_t ToTick(const TimePoint& time);
+
+		Vector<Node> mNodes;							/**< The pool of nodes */
+		std::uint32_t mSlots[Levels][SlotCount];		/**< The first node in each slot */
+		std::uint32_t mLevelSizes[Levels];				/**< The number of items on each level */
+		std::uint32_t mOverflow;						/**< The first node due beyond the last level */
+		std::uint32_t mOverflowSize;					/**< The number of items on the overflow list */
+		std::uint32_t mFreeNodes;						/**< The first unused node in the pool */
+		std::uint32_t mSize;							/**< The number of items */
+		std::uint64_t mCurrentTick;						/**< The tick the wheel has reached */
+
+		static const std::uint32_t NoNode = UINT32_MAX;
+	};
+}
+
+#include "TimingWheel.inl"
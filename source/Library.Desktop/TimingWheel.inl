@@ -0,0 +1,303 @@
+#include "pch.h"
+
+namespace Library
+{
+	template<typename T>
+	TimingWheel<T>::TimingWheel(Allocator& allocator) :
+		mNodes(0, false, allocator), mOverflow(NoNode), mOverflowSize(0), mFreeNodes(NoNode), mSize(0), mCurrentTick(0)
+	{
+		ResetSlots();
+	}
+
+	template<typename T>
+	TimingWheel<T>::TimingWheel(TimingWheel&& rhs) :
+		mNodes(std::move(rhs.mNodes)), mOverflow(rhs.mOverflow), mOverflowSize(rhs.mOverflowSize), mFreeNodes(rhs.mFreeNodes), mSize(rhs.mSize), mCurrentTick(rhs.mCurrentTick)
+	{
+		std::memcpy(mSlots, rhs.mSlots, sizeof(mSlots));
+		std::memcpy(mLevelSizes, rhs.mLevelSizes, sizeof(mLevelSizes));
+		rhs.Clear();
+	}
+
+	template<typename T>
+	TimingWheel<T>& TimingWheel<T>::operator=(TimingWheel&& rhs)
+	{
+		if (this != &rhs)
+		{
+			mNodes = std::move(rhs.mNodes);
+			std::memcpy(mSlots, rhs.mSlots, sizeof(mSlots));
+			std::memcpy(mLevelSizes, rhs.mLevelSizes, sizeof(mLevelSizes));
+			mOverflow = rhs.mOverflow;
+			mOverflowSize = rhs.mOverflowSize;
+			mFreeNodes = rhs.mFreeNodes;
+			mSize = rhs.mSize;
+			mCurrentTick = rhs.mCurrentTick;
+			rhs.Clear();
+		}
+
+		return *this;
+	}
+
+	template<typename T>
+	void TimingWheel<T>::Insert(const T& item, const TimePoint& expiry, const TimePoint& currentTime)
+	{
+		if (mSize == 0)
+		{
+			// Nothing refers to the old tick, so an empty wheel can start wherever it is needed
+			mCurrentTick = ToTick(currentTime);
+		}
+
+		const Node node = { item, expiry, ToTick(expiry), NoNode };
+		std::uint32_t index;
+		if (mFreeNodes != NoNode)
+		{
+			index = mFreeNodes;
+			mFreeNodes = mNodes[index].mNext;
+			mNodes[index] = node;
+		}
+		else
+		{
+			if (mNodes.Size() == mNodes.Capacity())
+			{
+				mNodes.Reserve(mNodes.Capacity() == 0 ? DefaultCapacity : mNodes.Capacity() * 2);
+			}
+			index = mNodes.Size();
+			mNodes.PushBack(node);
+		}
+
+		Place(index);
+		++mSize;
+	}
+
+	template<typename T>
+	template<typename FunctionT>
+	void TimingWheel<T>::Advance(const TimePoint& currentTime, FunctionT expire)
+	{
+		// Time running backwards only re-checks the current tick
+		std::uint64_t currentTick = ToTick(currentTime);
+		if (currentTick < mCurrentTick)
+		{
+			currentTick = mCurrentTick;
+		}
+
+		std::uint64_t tick = mCurrentTick;
+		while (mSize > 0)
+		{
+			mCurrentTick = tick;
+			Cascade(tick);
+
+			// Every item left in the slot is due on this tick; only the current tick can hold items that have not expired yet
+			std::uint32_t& slot = Slot(0, tick);
+			std::uint32_t index = slot;
+			slot = NoNode;
+			while (index != NoNode)
+			{
+				Node& node = mNodes[index];
+				const std::uint32_t next = node.mNext;
+				if (currentTime > node.mExpiry)
+				{
+					expire(node.mItem);
+					node.mNext = mFreeNodes;
+					mFreeNodes = index;
+					--mLevelSizes[0];
+					--mSize;
+				}
+				else
+				{
+					node.mNext = slot;
+					slot = index;
+				}
+				index = next;
+			}
+
+			if (tick == currentTick)
+			{
+				break;
+			}
+
+			tick = NextTick(tick);
+			if (tick > currentTick)
+			{
+				tick = currentTick;
+			}
+		}
+
+		mCurrentTick = currentTick;
+	}
+
+	template<typename T>
+	typename TimingWheel<T>::TimePoint TimingWheel<T>::NextExpiryTime() const
+	{
+		TimePoint nextExpiry = TimePoint::max();
+
+		// The soonest item is in the first occupied slot of the lowest occupied level
+		std::uint32_t first = mOverflow;
+		for (std::uint32_t level = 0; level < Levels; ++level)
+		{
+			if (mLevelSizes[level] > 0)
+			{
+				std::uint32_t slot = static_cast<std::uint32_t>(mCurrentTick >> (SlotBits * level)) & (SlotCount - 1);
+				while (mSlots[level][slot] == NoNode)
+				{
+					++slot;
+				}
+				first = mSlots[level][slot];
+				break;
+			}
+		}
+
+		for (std::uint32_t index = first; index != NoNode; index = mNodes[index].mNext)
+		{
+			if (mNodes[index].mExpiry < nextExpiry)
+			{
+				nextExpiry = mNodes[index].mExpiry;
+			}
+		}
+
+		return nextExpiry;
+	}
+
+	template<typename T>
+	template<typename FunctionT>
+	void TimingWheel<T>::ForEach(FunctionT function) const
+	{
+		for (std::uint32_t level = 0; level < Levels; ++level)
+		{
+			for (std::uint32_t slot = 0; slot < SlotCount; ++slot)
+			{
+				for (std::uint32_t index = mSlots[level][slot]; index != NoNode; index = mNodes[index].mNext)
+				{
+					function(mNodes[index].mItem);
+				}
+			}
+		}
+
+		for (std::uint32_t index = mOverflow; index != NoNode; index = mNodes[index].mNext)
+		{
+			function(mNodes[index].mItem);
+		}
+	}
+
+	template<typename T>
+	std::uint32_t TimingWheel<T>::Size() const
+	{
+		return mSize;
+	}
+
+	template<typename T>
+	bool TimingWheel<T>::IsEmpty() const
+	{
+		return (mSize == 0);
+	}
+
+	template<typename T>
+	void TimingWheel<T>::Clear()
+	{
+		mNodes.Clear();
+		ResetSlots();
+		mFreeNodes = NoNode;
+		mSize = 0;
+	}
+
+	template<typename T>
+	void TimingWheel<T>::Place(const std::uint32_t index)
+	{
+		Node& node = mNodes[index];
+		std::uint32_t* slot;
+		if (node.mTick <= mCurrentTick)
+		{
+			slot = &Slot(0, mCurrentTick);
+			++mLevelSizes[0];
+		}
+		else
+		{
+			// The highest group of tick bits that differs from the current tick picks the level
+			const std::uint64_t difference = node.mTick ^ mCurrentTick;
+			std::uint32_t level = 0;
+			while (level < Levels && (difference >> (SlotBits * (level + 1))) != 0)
+			{
+				++level;
+			}
+
+			if (level == Levels)
+			{
+				slot = &mOverflow;
+				++mOverflowSize;
+			}
+			else
+			{
+				slot = &Slot(level, node.mTick);
+				++mLevelSizes[level];
+			}
+		}
+
+		node.mNext = *slot;
+		*slot = index;
+	}
+
+	template<typename T>
+	void TimingWheel<T>::Cascade(const std::uint64_t tick)
+	{
+		// Each level whose slot starts on this tick drops its items to the levels below
+		for (std::uint32_t level = 1; level <= Levels; ++level)
+		{
+			if ((tick & ((1ULL << (SlotBits * level)) - 1)) != 0)
+			{
+				break;
+			}
+
+			std::uint32_t& slot = (level < Levels ? Slot(level, tick) : mOverflow);
+			std::uint32_t& levelSize = (level < Levels ? mLevelSizes[level] : mOverflowSize);
+			std::uint32_t index = slot;
+			slot = NoNode;
+			while (index != NoNode)
+			{
+				const std::uint32_t next = mNodes[index].mNext;
+				--levelSize;
+				Place(index);
+				index = next;
+			}
+		}
+	}
+
+	template<typename T>
+	std::uint64_t TimingWheel<T>::NextTick(const std::uint64_t tick) const
+	{
+		// Ticks where nothing expires or cascades are skipped
+		std::uint32_t level = 0;
+		while (level < Levels && mLevelSizes[level] == 0)
+		{
+			++level;
+		}
+
+		const std::uint64_t mask = (1ULL << (SlotBits * level)) - 1;
+		return (tick | mask) + 1;
+	}
+
+	template<typename T>
+	void TimingWheel<T>::ResetSlots()
+	{
+		for (std::uint32_t level = 0; level < Levels; ++level)
+		{
+			for (std::uint32_t slot = 0; slot < SlotCount; ++slot)
+			{
+				mSlots[level][slot] = NoNode;
+			}
+			mLevelSizes[level] = 0;
+		}
+
+		mOverflow = NoNode;
+		mOverflowSize = 0;
+	}
+
+	template<typename T>
+	std::uint32_t& TimingWheel<T>::Slot(const std::uint32_t level, const std::uint64_t tick)
+	{
+		return mSlots[level][(tick >> (SlotBits * level)) & (SlotCount - 1)];
+	}
+
+	template<typename T>
+	std::uint64_t TimingWheel<T>::ToTick(const TimePoint& time)
+	{
+		return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(time.time_since_epoch()).count());
+	}
+}
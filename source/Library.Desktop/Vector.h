@@ -91,8 +91,12 @@ namespace Library
 
 		/**
 		 * Default constructor to initialize the vector to be empty.
+		 *
+		 * @param capacity the initial capacity
+		 * @param isFixedSize whether the Vector's size is always kept equal to its capacity
+		 * @param allocator the Allocator the Vector's items come from
 		 */
-		Vector(std::uint32_t capacity = 0, const bool isFixedSize = false);
+		Vector(std::uint32_t capacity = 0, const bool isFixedSize = false, Allocator& allocator = Allocator::Default());
 
 		/**
 		 * Copy constructor that performs a deep copy.
@@ -102,7 +106,7 @@ namespace Library
 		Vector(const Vector& rhs);
 
 		/**
-		 * Move constructor.
+		 * Move constructor. The Vector's Allocator moves along with its items.
 		 * 
 		 * @param rhs the Vector to move
 		 */
@@ -122,7 +126,7 @@ namespace Library
 		Vector& operator=(const Vector& rhs);
 
 		/**
-		 * Assignment operator that moves a Vector
+		 * Assignment operator that moves a Vector. The Vector's Allocator moves along with its items.
 		 *
 		 * @param rhs the Vector to move
 		 */
@@ -275,6 +279,7 @@ namespace Library
 		std::uint32_t mCapacity;							/**< The space allocated for the Vector */
 		std::uint32_t mSize;								/**< The number of items in the Vector */
 		T* mItem;											/**< The data contained within the Vector */
+		Allocator* mAllocator;								/**< Where the Vector's items come from */
 		bool mIsFixedSize;									/**< Flag to set the Vector's size is always equal to its capacity */
 	};
 }
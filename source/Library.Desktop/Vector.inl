@@ -89,26 +89,26 @@ namespace Library
 #pragma region Vector
 
 	template<typename T>
-	Vector<T>::Vector(const std::uint32_t capacity, const bool isFixedSize) :
-		mSize(0), mCapacity(0), mItem(nullptr), mIsFixedSize(isFixedSize)
+	Vector<T>::Vector(const std::uint32_t capacity, const bool isFixedSize, Allocator& allocator) :
+		mSize(0), mCapacity(0), mItem(nullptr), mAllocator(&allocator), mIsFixedSize(isFixedSize)
 	{
 		Reserve(capacity);
 	}
 
 	template<typename T>
 	Vector<T>::Vector(const Vector& rhs) :
-		mSize(0), mCapacity(0), mItem(nullptr), mIsFixedSize(rhs.mIsFixedSize)
+		mSize(0), mCapacity(0), mItem(nullptr), mAllocator(&Allocator::Default()), mIsFixedSize(rhs.mIsFixedSize)
 	{
 		operator=(rhs);
 	}
 
 	template<typename T>
 	Vector<T>::Vector(Vector&& rhs) :
-		mSize(rhs.mSize), mCapacity(rhs.mCapacity), mData(rhs.mData), mIsFixedSize(rhs.mIsFixedSize)
+		mCapacity(rhs.mCapacity), mSize(rhs.mSize), mItem(rhs.mItem), mAllocator(rhs.mAllocator), mIsFixedSize(rhs.mIsFixedSize)
 	{
 		rhs.mSize = 0;
 		rhs.mCapacity = 0;
-		rhs.mData = nullptr;
+		rhs.mItem = nullptr;
 		rhs.mIsFixedSize = false;
 	}
 
@@ -138,12 +138,13 @@ namespace Library
 
 			mSize = rhs.mSize;
 			mCapacity = rhs.mCapacity;
-			mData = rhs.mData;
+			mItem = rhs.mItem;
+			mAllocator = rhs.mAllocator;
 			mIsFixedSize = rhs.mIsFixedSize;
 
 			rhs.mSize = 0;
 			rhs.mCapacity = 0;
-			rhs.mData = nullptr;
+			rhs.mItem = nullptr;
 		}
 
 		return *this;
@@ -288,7 +289,7 @@ namespace Library
 			mItem[i].~T();
 		}
 
-		free(mItem);
+		mAllocator->Deallocate(mItem, sizeof(T) * mCapacity);
 		mItem = nullptr;
 		mSize = 0;
 		mCapacity = 0;
@@ -311,7 +312,7 @@ namespace Library
 	{
 		if (capacity > mCapacity)
 		{
-			mItem = reinterpret_cast<T*>(std::realloc(mItem, sizeof(T) * capacity));
+			mItem = reinterpret_cast<T*>(mAllocator->Reallocate(mItem, sizeof(T) * mCapacity, sizeof(T) * capacity));
 
 			if (mIsFixedSize)
 			{
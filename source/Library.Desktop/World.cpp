@@ -4,20 +4,75 @@ namespace Library
 {
 	RTTI_DEFINITIONS(World)
 
+	const Symbol World::sSectorsName("sectors");
+
 	World::World()
-		: mName(), mEventQueue(), mWorldState(nullptr), Attributed()
+		: mName(), mEventQueue(), mEventPool(new Library::EventPool<EventMessageAttributed>()), mWorldState(nullptr), mArena(nullptr), Attributed()
 	{
 		AddExternalSignature("name", 1, &mName);
 		CreateTableDatum("sectors");
 		Populate();
+		Sectors();
 	}
 
-	World::World(const std::string& name)
-		: mName(name), mEventQueue(), mWorldState(nullptr), Attributed()
+	World::World(const std::string& name, const bool useArena)
+		: mName(name), mEventQueue(), mEventPool(new Library::EventPool<EventMessageAttributed>()), mWorldState(nullptr), mArena(useArena ? new LinearAllocator() : nullptr), Attributed()
 	{
 		AddExternalSignature("name", 1, &mName);
 		CreateTableDatum("sectors");
 		Populate();
+		Sectors();
+	}
+
+	World::World(World&& rhs)
+		: Attributed(std::move(rhs)), mName(std::move(rhs.mName)), mEventQueue(std::move(rhs.mEventQueue)),
+		mEventPool(rhs.mEventPool), mWorldState(rhs.mWorldState), mSectors(), mArena(rhs.mArena)
+	{
+		MoveExternalStorage(rhs, sizeof(World));
+		rhs.mWorldState = nullptr;
+		rhs.mEventPool = nullptr;
+		rhs.mArena = nullptr;
+	}
+
+	World& World::operator=(World&& rhs)
+	{
+		if (this != &rhs)
+		{
+			Attributed::operator=(std::move(rhs));
+			mName = std::move(rhs.mName);
+			// The pooled events still queued here go back to the old pool before it is released
+			mEventQueue.Clear();
+			mEventQueue = std::move(rhs.mEventQueue);
+			delete mEventPool;
+			mEventPool = rhs.mEventPool;
+			rhs.mEventPool = nullptr;
+			mWorldState = rhs.mWorldState;
+			MoveExternalStorage(rhs, sizeof(World));
+			rhs.mWorldState = nullptr;
+
+			// The old Sectors were destroyed by the assignment, so their arena can go
+			delete mArena;
+			mArena = rhs.mArena;
+			rhs.mArena = nullptr;
+		}
+
+		return *this;
+	}
+
+	World::~World()
+	{
+		// Queued events may have come from the pool, so they are released before it is
+		mEventQueue.Clear();
+		delete mEventPool;
+
+		if (mArena != nullptr)
+		{
+			// The Sectors live in the arena, so they have to be destroyed before it is released. The walk
+			// cannot be skipped: string payloads and names keep their characters on the heap, outside the
+			// arena, and Reactions leave their dispatcher in their destructors. Only the frees are saved.
+			Clear();
+			delete mArena;
+		}
 	}
 
 	const std::string& World::Name() const
@@ -32,13 +87,12 @@ namespace Library
 
 	Datum& World::Sectors() const
 	{
-		Datum* foundSectors = Find("sectors");
-		assert(foundSectors != nullptr);
-		return *foundSectors;
+		return FindCached(sSectorsName, mSectors);
 	}
 
 	Sector& World::CreateSector(const std::string& sectorName)
 	{
+		AllocatorGuard guard(mArena != nullptr ? *mArena : GetAllocator());
 		Sector* sector = new Sector(sectorName);
 		assert(sector != nullptr);
 		sector->SetWorld(*this);
@@ -73,6 +127,21 @@ namespace Library
 		state.sector = nullptr;
 	}
 
+	void World::Update(WorldState& state, JobSystem& jobSystem)
+	{
+		Datum& cachedSectors = Sectors();
+		for (std::uint32_t i = 0; i < cachedSectors.Size(); ++i)
+		{
+			Sector* sector = cachedSectors[i].As<Sector>();
+			assert(sector != nullptr);
+
+			state.sector = sector;
+			sector->Update(state, jobSystem);
+		}
+
+		state.sector = nullptr;
+	}
+
 	const Library::EventQueue& World::EventQueue() const
 	{
 		return *&mEventQueue;
@@ -83,6 +152,12 @@ namespace Library
 		return *&mEventQueue;
 	}
 
+	Library::EventPool<EventMessageAttributed>& World::EventPool()
+	{
+		assert(mEventPool != nullptr);
+		return *mEventPool;
+	}
+
 	const WorldState& World::GetWorldState() const
 	{
 		assert(mWorldState);
@@ -94,4 +169,9 @@ namespace Library
 		mWorldState = &state;
 	}
 
+	const LinearAllocator* World::Arena() const
+	{
+		return mArena;
+	}
+
 }
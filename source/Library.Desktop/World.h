@@ -6,8 +6,11 @@
 namespace Library
 {
 	class Datum;
+	class EventMessageAttributed;
+	class JobSystem;
 	class Sector;
 	class WorldState;
+	template<typename MessageT> class EventPool;
 
 	/**
 	 * A World defines a global Scope  the Scope that all other objects in the simulation share.
@@ -23,21 +26,40 @@ namespace Library
 		World();
 
 		/**
-		 * Constructs a World.
+		 * Constructs a World. A World can own an arena that its Sectors, Entities, Actions and
+		 * their values are allocated from. Tearing such a World down releases the arena in one
+		 * go instead of freeing every object separately, so nothing created below the World
+		 * may outlive it, and its children must only be created from one thread at a time.
 		 *
 		 * @param name the name of the World
+		 * @param useArena whether everything below the World is allocated from an arena it owns
 		 */
-		World(const std::string& name);
+		World(const std::string& name, const bool useArena = false);
 
-		// Prevent a World from being moved or copied
+		// Prevent a World from being copied
 		World(const World& rhs) = delete;
-		World (World&& rhs) = delete;
 		World& operator=(const World& rhs) = delete;
 
 		/**
-		 * Destructs a World.
+		 * Move a World. Its Sectors are re-parented and its queued Events and arena move with it.
+		 *
+		 * @param rhs the World to move from
+		 */
+		World(World&& rhs);
+
+		/**
+		 * Move a World. Its Sectors are re-parented and its queued Events and arena move with it.
+		 *
+		 * @param rhs the World to move from
+		 * @return a reference to this World
 		 */
-		virtual ~World() = default;
+		World& operator=(World&& rhs);
+
+		/**
+		 * Destructs a World. A World with an arena destroys its Sectors before releasing the arena,
+		 * so teardown is still one pass over every descendant, but no descendant is freed on its own.
+		 */
+		virtual ~World();
 
 		/**
 		 * Returns the name of the World.
@@ -75,6 +97,16 @@ namespace Library
 		 */
 		void Update(WorldState& state);
 
+		/**
+		 * Calls Update for each Sector within the World, updating the Entities of each Sector
+		 * in parallel on a JobSystem. A World that allocates from an arena is updated on the
+		 * calling thread instead, since the arena is not thread-safe.
+		 *
+		 * @param state the state of the world
+		 * @param jobSystem the JobSystem to run the Entities on
+		 */
+		void Update(WorldState& state, JobSystem& jobSystem);
+
 		/**
 		 * Returns the address of the world's global event queue.
 		 *
@@ -89,6 +121,13 @@ namespace Library
 		 */
 		Library::EventQueue& EventQueue();
 
+		/**
+		 * Returns the pool the World's ActionEvents take their events from.
+		 *
+		 * @return the EventPool
+		 */
+		Library::EventPool<EventMessageAttributed>& EventPool();
+
 		/**
 		 * Returns the address of the WorldState.
 		 *
@@ -103,9 +142,21 @@ namespace Library
 		 */
 		void SetWorldState(WorldState& state);
 
+		/**
+		 * Returns the arena everything below the World is allocated from.
+		 *
+		 * @return the address of the arena, or nullptr if the World does not use one
+		 */
+		const LinearAllocator* Arena() const;
+
 	private:
 		std::string mName;						/**< The name of the World */
 		Library::EventQueue mEventQueue;		/**< The global event queue for a world */
+		Library::EventPool<EventMessageAttributed>* mEventPool;		/**< Recycles the events fired by ActionEvents */
 		WorldState* mWorldState;				/**< The WorldState. */
+		mutable CachedAttribute mSectors;		/**< The resolved "sectors" Datum */
+		LinearAllocator* mArena;				/**< Where the World's descendants come from, or nullptr to use the World's Allocator */
+
+		static const Symbol sSectorsName;
 	};
 }
@@ -4,13 +4,21 @@ namespace Library
 {
 
 	WorldState::WorldState()
-		: mGameTime(new GameTime()), world(nullptr), sector(nullptr), entity(nullptr), action(nullptr)
+		: mGameTime(new GameTime()), mOwnsGameTime(true), world(nullptr), sector(nullptr), entity(nullptr), action(nullptr)
+	{
+	}
+
+	WorldState::WorldState(GameTime& gameTime)
+		: mGameTime(&gameTime), mOwnsGameTime(false), world(nullptr), sector(nullptr), entity(nullptr), action(nullptr)
 	{
 	}
 
 	WorldState::~WorldState()
 	{
-		delete mGameTime;
+		if (mOwnsGameTime)
+		{
+			delete mGameTime;
+		}
 	}
 
 	GameTime& WorldState::GetGameTime() const
@@ -21,6 +29,12 @@ namespace Library
 
 	void WorldState::SetGameTime(GameTime& gameTime)
 	{
+		if (mOwnsGameTime)
+		{
+			delete mGameTime;
+			mOwnsGameTime = false;
+		}
+
 		mGameTime = &gameTime;
 	}
 
@@ -22,6 +22,15 @@ namespace Library
 		 */
 		WorldState();
 
+		/**
+		 * Constructs a WorldState that shares a GameTime it does not own. Jobs that update
+		 * Sectors or Entities in parallel each get one of these, so that no two threads
+		 * write the same sector, entity and action fields.
+		 *
+		 * @param gameTime the current GameTime
+		 */
+		explicit WorldState(GameTime& gameTime);
+
 		// Prevent a WorldState from being moved or copied
 		WorldState(const WorldState& rhs) = delete;
 		WorldState(WorldState&& rhs) = delete;
@@ -48,5 +57,6 @@ namespace Library
 
 	private:
 		GameTime* mGameTime;			/**< The current GameTime */
+		bool mOwnsGameTime;				/**< Whether mGameTime was created by this WorldState */
 	};
 }
@@ -48,6 +48,7 @@ namespace Library
 						{
 							Reaction* reaction = Factory<Reaction>::Create(className);
 							reaction->SetName(instanceName);
+							entity->Adopt(*reaction, "reactions");
 							customSharedData->mScope = reaction;
 						}
 						return true;
@@ -106,6 +107,17 @@ namespace Library
 				customSharedData->mScope = action->GetParent();
 				return true;
 			}
+			else if (name == "reaction")
+			{
+				// The subtype was written through its attribute, so the Reaction is filed under it now that it is complete
+				ReactionAttributed* reaction = customSharedData->mScope->As<ReactionAttributed>();
+				if (reaction != nullptr)
+				{
+					reaction->Refile();
+				}
+				customSharedData->mScope = customSharedData->mScope->GetParent();
+				return true;
+			}
 		}
 
 		return false;
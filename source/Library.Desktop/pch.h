@@ -2,24 +2,42 @@
 
 #include <windows.h>
 #include <cstdint>
+#include <cstdlib>
 #include <cstring>
 #include <vector>
+#include <algorithm>
 #include <stdexcept>
 #include <new>
 #include <mutex>
+#include <shared_mutex>
+#include <atomic>
 #include <future>
+#if defined(DEBUG) | defined(_DEBUG)
+#include <crtdbg.h>
+#endif
 
 #include "glm/vec4.hpp"
 #include "glm/mat4x4.hpp"
 
 #include "RTTI.h"
 
+#include "Allocator.h"
+#include "SystemAllocator.h"
+#include "LinearAllocator.h"
+#include "Pool.h"
+#include "PoolAllocator.h"
 #include "SList.h"
 #include "Vector.h"
+#include "PriorityQueue.h"
+#include "TimingWheel.h"
+#include "MpscQueue.h"
 #include "HashMap.h"
+#include "Symbol.h"
 
+#include "Span.h"
 #include "Datum.h"
 #include "Scope.h"
+#include "ComponentStore.h"
 
 #include "IXmlParseHelper.h"
 #include "XmlParseMaster.h"
@@ -28,6 +46,7 @@
 #include "XmlParseHelperAction.h"
 
 #include "Factory.h"
+#include "JobSystem.h"
 
 #include "Entity.h"
 #include "Sector.h"
@@ -38,10 +57,13 @@
 #include "ActionList.h"
 #include "ActionIf.h"
 
+#include "SubscriberList.h"
 #include "EventPublisher.h"
+#include "IEventPool.h"
 #include "IEventSubscriber.h"
 #include "EventQueue.h"
 #include "Event.h"
+#include "EventPool.h"
 
 #include "Reaction.h"
 #include "ReactionAttributed.h"
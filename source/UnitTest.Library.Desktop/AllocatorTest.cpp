@@ -0,0 +1,236 @@
+#include "pch.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace Library;
+
+namespace UnitTestLibraryDesktop
+{
+	TEST_CLASS(AllocatorTest)
+	{
+	public:
+
+#if defined(DEBUG) | defined(_DEBUG)
+		TEST_METHOD_INITIALIZE(Initialize)
+		{
+			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
+			_CrtMemCheckpoint(&sStartMemState);
+		}
+
+		TEST_METHOD_CLEANUP(Cleanup)
+		{
+			_CrtMemState endMemState, diffMemState;
+			_CrtMemCheckpoint(&endMemState);
+			if (_CrtMemDifference(&diffMemState, &sStartMemState, &endMemState))
+			{
+				_CrtMemDumpStatistics(&diffMemState);
+				Assert::Fail(L"Memory Leaks!");
+			}
+		}
+#endif
+
+		TEST_METHOD(AllocatorTestSystemAllocator)
+		{
+			SystemAllocator allocator;
+			Assert::IsNull(allocator.Allocate(0));
+
+			std::int32_t* values = static_cast<std::int32_t*>(allocator.Allocate(sizeof(std::int32_t) * 4));
+			values[3] = 10;
+			values = static_cast<std::int32_t*>(allocator.Reallocate(values, sizeof(std::int32_t) * 4, sizeof(std::int32_t) * 8));
+			Assert::AreEqual(10, values[3]);
+			allocator.Deallocate(values, sizeof(std::int32_t) * 8);
+			allocator.Deallocate(nullptr, 0);
+		}
+
+#if defined(DEBUG) | defined(_DEBUG)
+		TEST_METHOD(AllocatorTestStatistics)
+		{
+			SystemAllocator allocator;
+			Assert::IsNull(allocator.Allocate(0));
+			Assert::AreEqual(static_cast<std::size_t>(0), allocator.AllocationCount());
+
+			void* memory = allocator.Allocate(sizeof(std::int32_t) * 4);
+			Assert::AreEqual(sizeof(std::int32_t) * 4, allocator.BytesInUse());
+
+			memory = allocator.Reallocate(memory, sizeof(std::int32_t) * 4, sizeof(std::int32_t) * 8);
+			Assert::AreEqual(sizeof(std::int32_t) * 8, allocator.BytesInUse());
+			Assert::AreEqual(sizeof(std::int32_t) * 8, allocator.PeakBytesInUse());
+
+			allocator.Deallocate(memory, sizeof(std::int32_t) * 8);
+			Assert::AreEqual(static_cast<std::size_t>(0), allocator.BytesInUse());
+			Assert::AreEqual(sizeof(std::int32_t) * 8, allocator.PeakBytesInUse());
+			Assert::AreEqual(static_cast<std::size_t>(1), allocator.AllocationCount());
+		}
+#else
+		TEST_METHOD(AllocatorTestStatistics)
+		{
+			// Release builds do not count, so every Allocator reports nothing in use
+			SystemAllocator allocator;
+			void* memory = allocator.Allocate(sizeof(std::int32_t));
+			Assert::AreEqual(static_cast<std::size_t>(0), allocator.BytesInUse());
+			Assert::AreEqual(static_cast<std::size_t>(0), allocator.PeakBytesInUse());
+			Assert::AreEqual(static_cast<std::size_t>(0), allocator.AllocationCount());
+			allocator.Deallocate(memory, sizeof(std::int32_t));
+		}
+#endif
+
+		TEST_METHOD(AllocatorTestLinearAllocator)
+		{
+			SystemAllocator backingAllocator;
+			{
+				LinearAllocator allocator(256, backingAllocator);
+				Assert::AreEqual(0U, allocator.PageCount());
+
+				char* first = static_cast<char*>(allocator.Allocate(10));
+				char* second = static_cast<char*>(allocator.Allocate(10));
+				Assert::IsTrue(second > first);
+				Assert::AreEqual(1U, allocator.PageCount());
+
+				// The most recent block grows in place, older blocks have to move
+				Assert::IsTrue(second == allocator.Reallocate(second, 10, 40));
+				std::memcpy(first, "linear", 7);
+				char* moved = static_cast<char*>(allocator.Reallocate(first, 10, 20));
+				Assert::IsTrue(moved != first);
+				Assert::IsTrue(std::strcmp(moved, "linear") == 0);
+
+				// Freeing the most recent block lets the next allocation reuse it
+				char* third = static_cast<char*>(allocator.Allocate(16));
+				allocator.Deallocate(third, 16);
+				Assert::IsTrue(third == allocator.Allocate(16));
+
+				// Oversized blocks get their own page and leave the current page in use
+				allocator.Allocate(1024);
+				Assert::AreEqual(2U, allocator.PageCount());
+				char* fourth = static_cast<char*>(allocator.Allocate(8));
+				Assert::IsTrue(fourth > third);
+				Assert::AreEqual(2U, allocator.PageCount());
+
+				allocator.Allocate(200);
+				Assert::AreEqual(3U, allocator.PageCount());
+
+				allocator.Reset();
+				Assert::AreEqual(1U, allocator.PageCount());
+#if defined(DEBUG) | defined(_DEBUG)
+				Assert::AreEqual(static_cast<std::size_t>(0), allocator.BytesInUse());
+#endif
+				Assert::IsNotNull(allocator.Allocate(16));
+				Assert::AreEqual(1U, allocator.PageCount());
+			}
+#if defined(DEBUG) | defined(_DEBUG)
+			Assert::AreEqual(static_cast<std::size_t>(0), backingAllocator.BytesInUse());
+#endif
+
+			auto expression = [] { LinearAllocator allocator(0); };
+			Assert::ExpectException<std::exception>(expression);
+		}
+
+		TEST_METHOD(AllocatorTestPoolAllocator)
+		{
+			SystemAllocator backingAllocator;
+			{
+				PoolAllocator allocator(sizeof(glm::vec4), 4, backingAllocator);
+				void* first = allocator.Allocate(sizeof(glm::vec4));
+				void* second = allocator.Allocate(sizeof(std::int32_t));
+				Assert::IsTrue(first != second);
+				Assert::AreEqual(1U, allocator.GetPool().BlockCount());
+				Assert::IsTrue(second == allocator.Reallocate(second, sizeof(std::int32_t), sizeof(glm::vec4)));
+
+				allocator.Deallocate(first, sizeof(glm::vec4));
+				Assert::IsTrue(first == allocator.Allocate(sizeof(float)));
+
+				auto expression = [&allocator] { allocator.Allocate(sizeof(glm::mat4)); };
+				Assert::ExpectException<std::exception>(expression);
+#if defined(DEBUG) | defined(_DEBUG)
+				Assert::AreNotEqual(static_cast<std::size_t>(0), backingAllocator.BytesInUse());
+#endif
+			}
+#if defined(DEBUG) | defined(_DEBUG)
+			Assert::AreEqual(static_cast<std::size_t>(0), backingAllocator.BytesInUse());
+#endif
+		}
+
+		TEST_METHOD(AllocatorTestContainers)
+		{
+			SystemAllocator allocator;
+			{
+				Vector<std::int32_t> vector(0, false, allocator);
+				SList<std::int32_t> list(allocator);
+				HashMap<std::int32_t, std::int32_t> hashMap(8, HashMap<std::int32_t, std::int32_t>::DefaultMaxLoadFactor, allocator);
+				Stack<std::int32_t> stack(allocator);
+				Datum datum(Datum::DatumType::String, 0, allocator);
+
+				for (std::int32_t i = 0; i < 20; ++i)
+				{
+					vector.PushBack(i);
+					list.PushBack(i);
+					hashMap.Insert(std::make_pair(i, i));
+					stack.Push(i);
+					datum.PushBack(std::to_string(i));
+				}
+				Assert::AreEqual(19, vector.Back());
+				Assert::AreEqual(19, list.Back());
+				Assert::AreEqual(19, hashMap[19]);
+				Assert::AreEqual(19, stack.Top());
+				Assert::IsTrue(datum.Get<std::string>(19) == "19");
+#if defined(DEBUG) | defined(_DEBUG)
+				Assert::IsTrue(allocator.AllocationCount() > 0);
+
+				// Copies go to the default Allocator, moves take their Allocator with them
+				const std::size_t bytesInUse = allocator.BytesInUse();
+				Vector<std::int32_t> copy(vector);
+				Datum datumCopy(datum);
+				Assert::AreEqual(bytesInUse, allocator.BytesInUse());
+
+				Vector<std::int32_t> moved(std::move(vector));
+				Datum movedDatum(std::move(datum));
+				HashMap<std::int32_t, std::int32_t> movedMap(std::move(hashMap));
+				Assert::AreEqual(bytesInUse, allocator.BytesInUse());
+
+				moved.Clear();
+				movedDatum.Clear();
+				Assert::IsTrue(allocator.BytesInUse() < bytesInUse);
+#endif
+			}
+#if defined(DEBUG) | defined(_DEBUG)
+			Assert::AreEqual(static_cast<std::size_t>(0), allocator.BytesInUse());
+#endif
+		}
+
+		TEST_METHOD(AllocatorTestArena)
+		{
+			LinearAllocator arena(256);
+			{
+				Vector<glm::vec4> positions(0, false, arena);
+				Datum names(Datum::DatumType::String, 4, arena);
+				for (std::int32_t i = 0; i < 16; ++i)
+				{
+					positions.PushBack(glm::vec4(static_cast<float>(i)));
+					names.PushBack("name");
+				}
+				Assert::AreEqual(16U, positions.Size());
+				Assert::IsTrue(glm::vec4(15.0f) == positions.Back());
+				Assert::AreEqual(16U, names.Size());
+			}
+
+			// Blocks freed out of order stay in the pages until everything is released in one go
+#if defined(DEBUG) | defined(_DEBUG)
+			Assert::IsTrue(arena.PeakBytesInUse() > 0);
+#endif
+			Assert::IsTrue(arena.PageCount() > 1);
+			arena.Reset();
+			Assert::AreEqual(1U, arena.PageCount());
+#if defined(DEBUG) | defined(_DEBUG)
+			Assert::AreEqual(static_cast<std::size_t>(0), arena.BytesInUse());
+#endif
+		}
+
+	private:
+#if defined(DEBUG) | defined(_DEBUG)
+		static _CrtMemState sStartMemState;
+#endif
+	};
+
+#if defined(DEBUG) | defined(_DEBUG)
+	_CrtMemState AllocatorTest::sStartMemState;
+#endif
+
+}
@@ -141,6 +141,33 @@ namespace UnitTestLibraryDesktop
 			Assert::AreEqual(14U, foo.AuxiliaryBegin());
 		}
 
+		TEST_METHOD(AttributedTestClearAuxiliaryAttributes)
+		{
+			AttributedFoo foo;
+			foo.ClearAuxiliaryAttributes();
+			Assert::AreEqual(14U, foo.Size());
+
+			foo.AppendAuxiliaryAttribute("NewAuxAttrib") = 1;
+			foo.AppendScope("NewAuxScope");
+			Assert::AreEqual(16U, foo.Size());
+			Assert::IsTrue(foo.NameAt(14U).Name() == "NewAuxAttrib");
+			Assert::IsTrue(foo.NameAt(15U).Name() == "NewAuxScope");
+			Assert::ExpectException<std::exception>([&] { foo.NameAt(16U); });
+
+			// The child scope goes with its attribute, and the prescribed attributes are untouched
+			const std::uint32_t revision = foo.Revision();
+			foo.ClearAuxiliaryAttributes();
+			Assert::AreEqual(14U, foo.Size());
+			Assert::IsNull(foo.Find("NewAuxAttrib"));
+			Assert::IsNull(foo.Find("NewAuxScope"));
+			Assert::IsTrue(foo.IsPrescribedAttribute("External String"));
+			Assert::AreNotEqual(revision, foo.Revision());
+
+			foo.AppendAuxiliaryAttribute("NewAuxAttrib") = 2;
+			Assert::AreEqual(15U, foo.Size());
+			Assert::IsTrue(*foo.Find("NewAuxAttrib") == 2);
+		}
+
 	private:
 #if defined(DEBUG) | defined(_DEBUG)
 		static _CrtMemState sStartMemState;
@@ -0,0 +1,164 @@
+#include "pch.h"
+#include "FooParticle.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace Library;
+
+namespace UnitTestLibraryDesktop
+{
+	TEST_CLASS(ComponentStoreTest)
+	{
+	public:
+
+#if defined(DEBUG) | defined(_DEBUG)
+		TEST_CLASS_INITIALIZE(InitializeClass)
+		{
+			// Intern the attribute and column names up front; they are never released and would otherwise read as leaks
+			for (const char* name : { "this", "name", "position", "velocity" })
+			{
+				Symbol symbol(name);
+			}
+		}
+
+		TEST_METHOD_INITIALIZE(Initialize)
+		{
+			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
+			_CrtMemCheckpoint(&sStartMemState);
+		}
+
+		TEST_METHOD_CLEANUP(Cleanup)
+		{
+			_CrtMemState endMemState, diffMemState;
+			_CrtMemCheckpoint(&endMemState);
+			if (_CrtMemDifference(&diffMemState, &sStartMemState, &endMemState))
+			{
+				_CrtMemDumpStatistics(&diffMemState);
+				Assert::Fail(L"Memory Leaks!");
+			}
+		}
+#endif
+
+		TEST_METHOD(ComponentStoreTestAttach)
+		{
+			FooParticle first(glm::vec4(1.0f), glm::vec4(1.0f, 0.0f, 0.0f, 0.0f));
+			FooParticle second(glm::vec4(2.0f), glm::vec4(0.0f, 2.0f, 0.0f, 0.0f));
+			{
+				ComponentStore store;
+				store.AddColumn("position", Datum::DatumType::Vector);
+				store.AddColumn("velocity", Datum::DatumType::Vector);
+				Assert::AreEqual(2U, store.ColumnCount());
+
+				Assert::AreEqual(0U, store.Attach(first));
+				Assert::AreEqual(1U, store.Attach(second));
+				Assert::IsTrue(store.IsAttached(second));
+				Assert::IsTrue(&store.Owner(1) == &second);
+
+				// A system walks the columns, and the Scope API sees the result
+				Span<glm::vec4> positions = store.Column<glm::vec4>("position");
+				Span<glm::vec4> velocities = store.Column<glm::vec4>("velocity");
+				Assert::AreEqual(2U, positions.Size());
+				for (std::uint32_t i = 0; i < positions.Size(); ++i)
+				{
+					positions[i] += velocities[i];
+				}
+				Assert::IsTrue(second.Find("position")->Get<glm::vec4>(0) == glm::vec4(2.0f, 4.0f, 2.0f, 2.0f));
+				Assert::IsTrue(second.Position() == glm::vec4(2.0f));
+
+				// Writes through the Datum land in the column
+				first.Find("velocity")->Set(glm::vec4(5.0f));
+				Assert::IsTrue(velocities[0] == glm::vec4(5.0f));
+
+				store.Detach(first);
+				Assert::IsFalse(store.IsAttached(first));
+				Assert::AreEqual(1U, store.Size());
+				Assert::IsTrue(first.Position() == glm::vec4(2.0f, 1.0f, 1.0f, 1.0f));
+				Assert::IsTrue(first.Velocity() == glm::vec4(5.0f));
+				Assert::IsTrue(&first.Find("position")->Get<glm::vec4>(0) == &first.Position());
+				Assert::IsTrue(&store.Owner(0) == &second);
+			}
+
+			// The store copies the values back when it goes away
+			Assert::IsTrue(second.Position() == glm::vec4(2.0f, 4.0f, 2.0f, 2.0f));
+			Assert::IsTrue(second.Find("position")->Get<glm::vec4>(0) == second.Position());
+		}
+
+		TEST_METHOD(ComponentStoreTestRows)
+		{
+			ComponentStore store;
+			store.AddColumn("position", Datum::DatumType::Vector);
+
+			// Enough rows to grow the columns past their first reservation
+			const std::uint32_t count = ComponentStore::DefaultCapacity * 2 + 1;
+			Vector<FooParticle*> particles;
+			for (std::uint32_t i = 0; i < count; ++i)
+			{
+				particles.PushBack(new FooParticle(glm::vec4(static_cast<float>(i))));
+				store.Attach(*particles.Back());
+			}
+			for (std::uint32_t i = 0; i < count; ++i)
+			{
+				Assert::IsTrue(particles[i]->Find("position")->Get<glm::vec4>(0) == glm::vec4(static_cast<float>(i)));
+			}
+
+			// The last row fills the hole and its Datum follows it
+			store.Detach(*particles[3]);
+			Assert::IsTrue(&store.Owner(3) == particles[count - 1]);
+			Assert::IsTrue(&particles[count - 1]->Find("position")->Get<glm::vec4>(0) == &store.Column<glm::vec4>("position")[3]);
+
+			// Objects destroyed while attached leave on their own
+			delete particles[5];
+			Assert::AreEqual(count - 2, store.Size());
+			Assert::IsTrue(store.Column<glm::vec4>("position")[5] == particles[count - 2]->Find("position")->Get<glm::vec4>(0));
+
+			// Moved objects take over their row
+			FooParticle moved(std::move(*particles[0]));
+			Assert::IsTrue(&store.Owner(0) == &moved);
+			Assert::IsTrue(store.IsAttached(moved));
+			Assert::IsFalse(store.IsAttached(*particles[0]));
+			Assert::IsTrue(&moved.Find("position")->Get<glm::vec4>(0) == &store.Column<glm::vec4>("position")[0]);
+
+			for (std::uint32_t i = 0; i < count; ++i)
+			{
+				if (i != 5)
+				{
+					delete particles[i];
+				}
+			}
+			Assert::AreEqual(1U, store.Size());
+		}
+
+		TEST_METHOD(ComponentStoreTestErrors)
+		{
+			ComponentStore store;
+			Assert::ExpectException<std::exception>([&store] { store.AddColumn("name", Datum::DatumType::String); });
+			Assert::ExpectException<std::exception>([&store] { store.AddColumn("position", Datum::DatumType::Vector, 0); });
+			store.AddColumn("position", Datum::DatumType::Vector);
+			Assert::ExpectException<std::exception>([&store] { store.AddColumn("position", Datum::DatumType::Vector); });
+
+			// Every column needs a matching external attribute
+			Entity entity("Entity");
+			Assert::ExpectException<std::exception>([&store, &entity] { store.Attach(entity); });
+			Assert::IsFalse(store.IsAttached(entity));
+			Assert::ExpectException<std::exception>([&store, &entity] { store.Detach(entity); });
+
+			FooParticle particle;
+			store.Attach(particle);
+			Assert::ExpectException<std::exception>([&store, &particle] { store.Attach(particle); });
+			Assert::ExpectException<std::exception>([&store] { store.AddColumn("velocity", Datum::DatumType::Vector); });
+			Assert::ExpectException<std::exception>([&store] { store.Column<float>("position"); });
+			Assert::ExpectException<std::exception>([&store] { store.Column<glm::vec4>("velocity"); });
+			Assert::ExpectException<std::exception>([&store] { store.Owner(1); });
+			store.Detach(particle);
+		}
+
+	private:
+#if defined(DEBUG) | defined(_DEBUG)
+		static _CrtMemState sStartMemState;
+#endif
+	};
+
+#if defined(DEBUG) | defined(_DEBUG)
+	_CrtMemState ComponentStoreTest::sStartMemState;
+#endif
+
+}
@@ -61,6 +61,38 @@ namespace UnitTestLibraryDesktop
 			}
 		}
 
+		TEST_METHOD(DatumTestMoveSemantics)
+		{
+			Datum inlineDatum;
+			inlineDatum = 5;
+			Datum movedInline(std::move(inlineDatum));
+			Assert::IsTrue(movedInline.IsInline());
+			Assert::AreEqual(5, movedInline.Get<std::int32_t>(0));
+			Assert::IsTrue(inlineDatum.Type() == Datum::DatumType::Unknown);
+			Assert::AreEqual(0U, inlineDatum.Size());
+
+			Datum stringDatum;
+			stringDatum.Set(std::string("a"), 0);
+			stringDatum.Set(std::string("b"), 1);
+			const std::string* values = &stringDatum.Get<std::string>(0);
+			Datum movedString;
+			movedString = 1;
+			Assert::ExpectException<std::exception>([&] { movedString = std::string("c"); });
+			movedString = std::move(stringDatum);
+			Assert::IsTrue(movedString.Type() == Datum::DatumType::String);
+			Assert::AreEqual(2U, movedString.Size());
+			Assert::IsTrue(&movedString.Get<std::string>(0) == values);
+			Assert::AreEqual(0U, stringDatum.Capacity());
+
+			std::int32_t external[] = { 1, 2 };
+			Datum externalDatum;
+			externalDatum.SetStorage(external, 2);
+			Datum movedExternal(std::move(externalDatum));
+			Assert::IsTrue(movedExternal.IsExternal());
+			Assert::IsTrue(&movedExternal.Get<std::int32_t>(1) == &external[1]);
+			Assert::IsFalse(externalDatum.IsExternal());
+		}
+
 		TEST_METHOD(DatumTestAssignmentOperator)
 		{
 			// Test external datum
@@ -104,7 +136,7 @@ namespace UnitTestLibraryDesktop
 			}
 			intDatum = 2;
 			Assert::AreEqual(1U, intDatum.Size());
-			Assert::AreEqual(3U, intDatum.Capacity());
+			Assert::AreEqual(4U, intDatum.Capacity());
 			Assert::IsTrue(intDatum.Type() == Datum::DatumType::Integer);
 			Assert::IsFalse(intDatum.IsExternal());
 			Assert::AreEqual(2, intDatum.Get<std::int32_t>(0));
@@ -127,7 +159,7 @@ namespace UnitTestLibraryDesktop
 			}
 			floatDatum = 2.0f;
 			Assert::AreEqual(1U, floatDatum.Size());
-			Assert::AreEqual(3U, floatDatum.Capacity());
+			Assert::AreEqual(4U, floatDatum.Capacity());
 			Assert::IsTrue(floatDatum.Type() == Datum::DatumType::Float);
 			Assert::IsFalse(floatDatum.IsExternal());
 			Assert::AreEqual(2.0f, floatDatum.Get<float>(0));
@@ -150,7 +182,7 @@ namespace UnitTestLibraryDesktop
 			}
 			vectorDatum = glm::vec4(2.0f, 2.0f, 2.0f, 2.0f);
 			Assert::AreEqual(1U, vectorDatum.Size());
-			Assert::AreEqual(3U, vectorDatum.Capacity());
+			Assert::AreEqual(4U, vectorDatum.Capacity());
 			Assert::IsTrue(vectorDatum.Type() == Datum::DatumType::Vector);
 			Assert::IsFalse(vectorDatum.IsExternal());
 			Assert::IsTrue(glm::vec4(2.0f, 2.0f, 2.0f, 2.0f) == vectorDatum.Get<glm::vec4>(0));
@@ -173,7 +205,7 @@ namespace UnitTestLibraryDesktop
 			}
 			matrixDatum = glm::mat4(2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f);
 			Assert::AreEqual(1U, matrixDatum.Size());
-			Assert::AreEqual(3U, matrixDatum.Capacity());
+			Assert::AreEqual(4U, matrixDatum.Capacity());
 			Assert::IsTrue(matrixDatum.Type() == Datum::DatumType::Matrix);
 			Assert::IsFalse(matrixDatum.IsExternal());
 			Assert::IsTrue(glm::mat4(2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f) 
@@ -202,7 +234,7 @@ namespace UnitTestLibraryDesktop
 			}
 			tableDatum = scopeD;
 			Assert::AreEqual(1U, tableDatum.Size());
-			Assert::AreEqual(3U, tableDatum.Capacity());
+			Assert::AreEqual(4U, tableDatum.Capacity());
 			Assert::IsTrue(tableDatum.Type() == Datum::DatumType::Table);
 			Assert::IsFalse(tableDatum.IsExternal());
 			Assert::IsTrue(scopeD == tableDatum.Get<Scope*>(0));
@@ -225,7 +257,7 @@ namespace UnitTestLibraryDesktop
 			}
 			stringDatum = "new";
 			Assert::AreEqual(1U, stringDatum.Size());
-			Assert::AreEqual(3U, stringDatum.Capacity());
+			Assert::AreEqual(4U, stringDatum.Capacity());
 			Assert::IsTrue(stringDatum.Type() == Datum::DatumType::String);
 			Assert::IsFalse(stringDatum.IsExternal());
 			Assert::IsTrue("new" == stringDatum.Get<std::string>(0));
@@ -251,7 +283,7 @@ namespace UnitTestLibraryDesktop
 			Assert::AreEqual(3U, intDatum.Size());
 			intDatum = 1;
 			Assert::AreEqual(1U, intDatum.Size());
-			Assert::AreEqual(3U, intDatum.Capacity());
+			Assert::AreEqual(4U, intDatum.Capacity());
 			Assert::IsTrue(intDatum.Type() == Datum::DatumType::Integer);
 			Assert::IsFalse(intDatum.IsExternal());
 			Assert::AreEqual(1, intDatum.Get<std::int32_t>(0));
@@ -272,7 +304,7 @@ namespace UnitTestLibraryDesktop
 			Assert::AreEqual(3U, floatDatum.Size());
 			floatDatum = 1.0f;
 			Assert::AreEqual(1U, floatDatum.Size());
-			Assert::AreEqual(3U, floatDatum.Capacity());
+			Assert::AreEqual(4U, floatDatum.Capacity());
 			Assert::IsTrue(floatDatum.Type() == Datum::DatumType::Float);
 			Assert::IsFalse(floatDatum.IsExternal());
 			Assert::AreEqual(1.0f, floatDatum.Get<float>(0));
@@ -295,7 +327,7 @@ namespace UnitTestLibraryDesktop
 			Assert::AreEqual(3U, vectorDatum.Size());
 			vectorDatum = oneVec;
 			Assert::AreEqual(1U, vectorDatum.Size());
-			Assert::AreEqual(3U, vectorDatum.Capacity());
+			Assert::AreEqual(4U, vectorDatum.Capacity());
 			Assert::IsTrue(vectorDatum.Type() == Datum::DatumType::Vector);
 			Assert::IsFalse(vectorDatum.IsExternal());
 			Assert::IsTrue(oneVec == vectorDatum.Get<glm::vec4>(0));
@@ -318,7 +350,7 @@ namespace UnitTestLibraryDesktop
 			Assert::AreEqual(3U, matrixDatum.Size());
 			matrixDatum = oneMat;
 			Assert::AreEqual(1U, matrixDatum.Size());
-			Assert::AreEqual(3U, matrixDatum.Capacity());
+			Assert::AreEqual(4U, matrixDatum.Capacity());
 			Assert::IsTrue(matrixDatum.Type() == Datum::DatumType::Matrix);
 			Assert::IsFalse(matrixDatum.IsExternal());
 			Assert::IsTrue(oneMat == matrixDatum.Get<glm::mat4>(0));
@@ -341,7 +373,7 @@ namespace UnitTestLibraryDesktop
 			Assert::AreEqual(3U, stringDatum.Size());
 			stringDatum = stringB;
 			Assert::AreEqual(1U, stringDatum.Size());
-			Assert::AreEqual(3U, stringDatum.Capacity());
+			Assert::AreEqual(4U, stringDatum.Capacity());
 			Assert::IsTrue(stringDatum.Type() == Datum::DatumType::String);
 			Assert::IsFalse(stringDatum.IsExternal());
 			Assert::IsTrue(stringB == stringDatum.Get<std::string>(0));
@@ -367,6 +399,143 @@ namespace UnitTestLibraryDesktop
 			Assert::AreEqual(20U, datum.Capacity());
 		}
 
+		TEST_METHOD(DatumTestGrowthStrategy)
+		{
+			Datum datum;
+			datum.SetType(Datum::DatumType::Integer);
+			for (std::int32_t i = 0; i < 100; ++i)
+			{
+				datum.PushBack(i);
+			}
+			Assert::AreEqual(100U, datum.Size());
+			Assert::AreEqual(128U, datum.Capacity());
+			for (std::int32_t i = 0; i < 100; ++i)
+			{
+				Assert::AreEqual(i, datum.Get<std::int32_t>(i));
+			}
+
+			Datum stringDatum;
+			stringDatum.SetType(Datum::DatumType::String);
+			for (std::int32_t i = 0; i < 10; ++i)
+			{
+				stringDatum.PushBack(std::to_string(i));
+			}
+			Assert::AreEqual(16U, stringDatum.Capacity());
+			Assert::IsTrue(stringDatum.Get<std::string>(9) == "9");
+
+			// Each Datum has its own strategy, so changing one leaves every other Datum alone
+			Datum linearDatum;
+			linearDatum.SetGrowthStrategy([](const std::uint32_t capacity) { return capacity + 10; });
+			linearDatum.SetType(Datum::DatumType::Float);
+			linearDatum.PushBack(1.0f);
+			Assert::AreEqual(10U, linearDatum.Capacity());
+			Datum otherDatum;
+			otherDatum.SetType(Datum::DatumType::Float);
+			otherDatum.PushBack(1.0f);
+			Assert::AreEqual(1U, otherDatum.Capacity());
+			Assert::IsTrue(otherDatum.GetGrowthStrategy() == Datum::DefaultGrowthStrategy);
+
+			// Copies and moves keep the strategy of the Datum they were constructed from
+			Datum copiedDatum(linearDatum);
+			Assert::IsTrue(copiedDatum.GetGrowthStrategy() == linearDatum.GetGrowthStrategy());
+			Datum movedDatum(std::move(copiedDatum));
+			Assert::IsTrue(movedDatum.GetGrowthStrategy() == linearDatum.GetGrowthStrategy());
+
+			linearDatum.SetGrowthStrategy([](const std::uint32_t) { return 0U; });
+			linearDatum.Reserve(11);
+			linearDatum.PushBack(2.0f);
+			Assert::AreEqual(11U, linearDatum.Capacity());
+			linearDatum.SetGrowthStrategy(nullptr);
+			Assert::IsTrue(linearDatum.GetGrowthStrategy() == Datum::DefaultGrowthStrategy);
+			Assert::AreEqual(8U, Datum::DefaultGrowthStrategy(4));
+
+			std::int32_t external = 0;
+			Datum externalDatum;
+			externalDatum.SetStorage(&external, 1);
+			Assert::ExpectException<std::exception>([&] { externalDatum.PushBack(1); });
+		}
+
+		TEST_METHOD(DatumTestInlineStorage)
+		{
+			Datum intDatum;
+			intDatum = 5;
+			Assert::IsTrue(intDatum.IsInline());
+			Assert::AreEqual(1U, intDatum.Capacity());
+
+			Datum copy(intDatum);
+			Assert::IsTrue(copy.IsInline());
+			copy.Set(6, 0);
+			Assert::AreEqual(5, intDatum.Get<std::int32_t>(0));
+			Assert::AreEqual(6, copy.Get<std::int32_t>(0));
+
+			intDatum.PushBack(7);
+			Assert::IsFalse(intDatum.IsInline());
+			Assert::AreEqual(5, intDatum.Get<std::int32_t>(0));
+			Assert::AreEqual(7, intDatum.Get<std::int32_t>(1));
+
+			Datum vectorDatum;
+			vectorDatum = glm::vec4(1.0f, 2.0f, 3.0f, 4.0f);
+			Assert::IsTrue(vectorDatum.IsInline());
+			vectorDatum.PushBack(glm::vec4(5.0f));
+			Assert::IsFalse(vectorDatum.IsInline());
+			Assert::IsTrue(vectorDatum.Get<glm::vec4>(0) == glm::vec4(1.0f, 2.0f, 3.0f, 4.0f));
+
+			Datum stringDatum;
+			stringDatum = std::string("inline");
+			Assert::IsFalse(stringDatum.IsInline());
+
+			std::int32_t external = 0;
+			Datum externalDatum;
+			externalDatum.SetStorage(&external, 1);
+			Assert::IsFalse(externalDatum.IsInline());
+
+			intDatum.Clear();
+			Assert::IsFalse(intDatum.IsInline());
+			intDatum = 8;
+			Assert::IsTrue(intDatum.IsInline());
+		}
+
+		TEST_METHOD(DatumTestAsSpan)
+		{
+			Datum floatDatum;
+			floatDatum.SetType(Datum::DatumType::Float);
+			for (std::uint32_t i = 0; i < 10; ++i)
+			{
+				floatDatum.PushBack(static_cast<float>(i));
+			}
+
+			Span<float> floats = floatDatum.AsSpan<float>();
+			Assert::AreEqual(10U, floats.Size());
+			Assert::IsTrue(floats.Data() == &floatDatum.Get<float>(0));
+			for (float& value : floats)
+			{
+				value *= 2.0f;
+			}
+			Assert::AreEqual(18.0f, floatDatum.Get<float>(9));
+			Assert::ExpectException<std::exception>([&] { floatDatum.AsSpan<std::int32_t>(); });
+
+			const Datum& constDatum = floatDatum;
+			Span<const float> constFloats = constDatum.AsSpan<float>();
+			float sum = 0.0f;
+			for (std::uint32_t i = 0; i < constFloats.Size(); ++i)
+			{
+				sum += constFloats[i];
+			}
+			Assert::AreEqual(90.0f, sum);
+
+			glm::vec4 positions[] = { glm::vec4(1.0f), glm::vec4(2.0f) };
+			Datum vectorDatum;
+			vectorDatum.SetStorage(positions, 2);
+			Span<glm::vec4> vectors = vectorDatum.AsSpan<glm::vec4>();
+			Assert::IsTrue(vectors.Data() == positions);
+			Assert::IsTrue(vectors[1] == glm::vec4(2.0f));
+
+			Datum emptyDatum;
+			emptyDatum.SetType(Datum::DatumType::String);
+			Assert::IsTrue(emptyDatum.AsSpan<std::string>().IsEmpty());
+			Assert::IsTrue(Span<std::int32_t>().begin() == Span<std::int32_t>().end());
+		}
+
 		TEST_METHOD(DatumTestPushBackInteger)
 		{
 			Datum datum;
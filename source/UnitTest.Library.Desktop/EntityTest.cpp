@@ -110,6 +110,64 @@ namespace UnitTestLibraryDesktop
 			Assert::AreEqual(entity.Actions().Size(), actionCount);
 		}
 
+		TEST_METHOD(EntityTestCachedAttributes)
+		{
+			Entity entity("Entity1");
+			Assert::IsTrue(&entity.Actions() == entity.Find("actions"));
+
+			const std::uint32_t revision = entity.Revision();
+			entity.AppendAuxiliaryAttribute("Health").Set(100);
+			Assert::AreEqual(revision, entity.Revision());
+			Assert::IsTrue(&entity.Actions() == entity.Find("actions"));
+
+			Entity other("Entity2");
+			entity = other;
+			Assert::AreNotEqual(revision, entity.Revision());
+			Assert::IsTrue(&entity.Actions() == entity.Find("actions"));
+
+			Sector sector("Sector1");
+			Assert::IsTrue(&sector.Entities() == sector.Find("entities"));
+
+			World world("World1");
+			Assert::IsTrue(&world.Sectors() == world.Find("sectors"));
+		}
+
+		TEST_METHOD(EntityTestMoveSemantics)
+		{
+			FooActionFactory actionFactory;
+			EntityFactory entityFactory;
+			Entity entity("Entity1");
+			Action& action = entity.CreateAction("FooAction", "FooAction_1");
+
+			Entity moved(std::move(entity));
+			Assert::IsTrue(moved.Name() == "Entity1");
+			moved.SetName("Renamed");
+			Assert::IsTrue(moved.Find("this")->Get<RTTI*>(0) == &moved);
+			Assert::AreEqual(1U, moved.Actions().Size());
+			Assert::IsTrue(action.GetParent() == &moved);
+			Assert::AreEqual(0U, entity.Size());
+
+			Entity assigned;
+			assigned = std::move(moved);
+			Assert::IsTrue(assigned.Name() == "Renamed");
+			Assert::IsTrue(assigned.Find("this")->Get<RTTI*>(0) == &assigned);
+			Assert::IsTrue(action.GetParent() == &assigned);
+
+			Sector sector("Sector1");
+			Entity& child = sector.CreateEntity("Entity", "Child");
+			Sector movedSector(std::move(sector));
+			Assert::IsTrue(movedSector.Name() == "Sector1");
+			Assert::IsTrue(&child.GetSector() == &movedSector);
+			Assert::AreEqual(1U, movedSector.Entities().Size());
+
+			World world("World1");
+			Sector& worldSector = world.CreateSector("Sector2");
+			World movedWorld(std::move(world));
+			Assert::IsTrue(movedWorld.Name() == "World1");
+			Assert::IsTrue(worldSector.GetWorld() == &movedWorld);
+			Assert::AreEqual(1U, movedWorld.Sectors().Size());
+		}
+
 		TEST_METHOD(EntityTestCreateAction)
 		{
 			FooActionFactory actionFactory;
@@ -140,6 +198,139 @@ namespace UnitTestLibraryDesktop
 			world.Update(state);
 		}
 
+		TEST_METHOD(EntityTestParallelUpdate)
+		{
+			EntityFactory entityFactory;
+			FooActionFactory actionFactory;
+			JobSystem jobSystem(3);
+			Library::WorldState state;
+
+			World world("World1");
+			Sector& sector = world.CreateSector("Sector1");
+			Vector<FooAction*> actions;
+			for (std::int32_t i = 0; i < 100; ++i)
+			{
+				Entity& entity = sector.CreateEntity("Entity", "Entity" + std::to_string(i));
+				actions.PushBack(static_cast<FooAction*>(&entity.CreateAction("FooAction", "Action")));
+			}
+			actions[42]->SetParallelSafe(false);
+			Assert::IsFalse(actions[42]->GetParent()->As<Entity>()->IsParallelSafe());
+			Assert::IsTrue(actions[0]->GetParent()->As<Entity>()->IsParallelSafe());
+
+			world.Update(state, jobSystem);
+			sector.Update(state, jobSystem, 1);
+			for (FooAction* action : actions)
+			{
+				Assert::AreEqual(2U, action->UpdateCount());
+			}
+
+			// Entities that are not parallel-safe run on the calling thread with the caller's WorldState
+			Assert::IsTrue(actions[42]->LastThread() == std::this_thread::get_id());
+			Assert::IsNull(state.entity);
+			Assert::IsNull(state.action);
+		}
+
+		TEST_METHOD(EntityTestParallelUpdateActionEvent)
+		{
+			EntityFactory entityFactory;
+			ActionEventFactory actionEventFactory;
+			FooActionFactory actionFactory;
+			JobSystem jobSystem(3);
+			World world("World1");
+			Library::WorldState state;
+			state.world = &world;
+
+			// Entities that fire events are parallel-safe, so they are all updated by the parallel pass
+			Sector& sector = world.CreateSector("Sector1");
+			Vector<FooAction*> actions;
+			for (std::int32_t i = 0; i < 64; ++i)
+			{
+				Entity& entity = sector.CreateEntity("Entity", "Entity" + std::to_string(i));
+				Action& actionEvent = entity.CreateAction("ActionEvent", "Fire");
+				actionEvent["subtype"] = std::string("fire");
+				actionEvent["delay"] = 1000;
+				actions.PushBack(static_cast<FooAction*>(&entity.CreateAction("FooAction", "Action")));
+				Assert::IsTrue(actionEvent.IsParallelSafe());
+				Assert::IsTrue(entity.IsParallelSafe());
+			}
+
+			actions[0]->SetParallelSafe(false);
+			Assert::IsFalse(actions[0]->GetParent()->As<Entity>()->IsParallelSafe());
+			sector.Update(state, jobSystem, 1);
+			Assert::AreEqual(64U, world.EventQueue().Size());
+
+			for (FooAction* action : actions)
+			{
+				Assert::AreEqual(1U, action->UpdateCount());
+			}
+
+			// Only the Entity whose FooAction opted out was held back for the calling thread
+			Assert::IsTrue(actions[0]->LastThread() == std::this_thread::get_id());
+			Assert::IsNull(state.entity);
+		}
+
+		TEST_METHOD(EntityTestParallelUpdateImmediateActionEvent)
+		{
+			EntityFactory entityFactory;
+			ActionEventFactory actionEventFactory;
+			JobSystem jobSystem(3);
+			World world("World1");
+			Library::WorldState state;
+			state.world = &world;
+			world.SetWorldState(state);
+
+			// The reaction copies each event's parameters into itself, so it must never run on two threads at once
+			ReactionAttributed reaction("Reaction");
+			FooAction& reactionAction = *new FooAction("ReactionAction");
+			reaction.Adopt(reactionAction, "actions");
+			reaction.SetSubtype("hit");
+
+			// Events without a delay are sent on the spot, so the Entities that fire them are held back for the calling thread
+			Sector& sector = world.CreateSector("Sector1");
+			for (std::int32_t i = 0; i < 16; ++i)
+			{
+				Entity& entity = sector.CreateEntity("Entity", "Entity" + std::to_string(i));
+				ActionEvent& actionEvent = static_cast<ActionEvent&>(entity.CreateAction("ActionEvent", "Fire"));
+				actionEvent["subtype"] = std::string("hit");
+				actionEvent.AppendAuxiliaryAttribute("damage") = i;
+				Assert::IsFalse(actionEvent.IsParallelSafe());
+				Assert::IsFalse(entity.IsParallelSafe());
+			}
+
+			sector.Update(state, jobSystem, 1);
+			Assert::IsTrue(world.EventQueue().IsEmpty());
+			Assert::AreEqual(16U, reactionAction.UpdateCount());
+			Assert::IsTrue(reactionAction.LastThread() == std::this_thread::get_id());
+			Assert::AreEqual(15, reaction["damage"].Get<std::int32_t>(0));
+		}
+
+		TEST_METHOD(EntityTestParallelUpdateArena)
+		{
+			EntityFactory entityFactory;
+			FooActionFactory actionFactory;
+			JobSystem jobSystem(3);
+			Library::WorldState state;
+
+			// Parallel-safe Actions of an arena World could allocate from it, so they all run on the calling thread
+			World world("World1", true);
+			Sector& sector = world.CreateSector("Sector1");
+			Vector<FooAction*> actions;
+			for (std::int32_t i = 0; i < 16; ++i)
+			{
+				Entity& entity = sector.CreateEntity("Entity", "Entity" + std::to_string(i));
+				actions.PushBack(static_cast<FooAction*>(&entity.CreateAction("FooAction", "Action")));
+			}
+
+			world.Update(state, jobSystem);
+			sector.Update(state, jobSystem, 1);
+			for (FooAction* action : actions)
+			{
+				Assert::AreEqual(2U, action->UpdateCount());
+				Assert::IsTrue(action->LastThread() == std::this_thread::get_id());
+			}
+			Assert::IsNull(state.entity);
+		}
+
 		TEST_METHOD(EntityTestSectorGetSetWorld)
 		{
 			World world("World1");
@@ -166,6 +357,20 @@ namespace UnitTestLibraryDesktop
 			Sector sector2("Sector2");
 			sector2.CreateEntity("Entity", "EntityInSector2");
 			Assert::AreEqual(1U, sector2.Entities().Size());
+
+			entity1.SetSector(sector2);
+			Assert::AreEqual(2U, sector.Entities().Size());
+			Assert::AreEqual(2U, sector2.Entities().Size());
+			Assert::IsTrue(&entity1.GetSector() == &sector2);
+			entity3.SetSector(sector2);
+			Assert::AreEqual(1U, sector.Entities().Size());
+			Assert::IsTrue(sector.Entities().Get<Scope*>(0) == &entity2);
+
+			// sector2 is destroyed before the entities, so hand them back
+			entity1.SetSector(sector);
+			entity3.SetSector(sector);
+			Assert::AreEqual(3U, sector.Entities().Size());
+			Assert::AreEqual(1U, sector2.Entities().Size());
 		}
 
 		TEST_METHOD(EntityTestSectorCreateEntity)
@@ -204,6 +409,49 @@ namespace UnitTestLibraryDesktop
 			Assert::IsTrue(sector.Name() == "NewSector");
 		}
 
+		TEST_METHOD(EntityTestWorldArena)
+		{
+			EntityFactory entityFactory;
+			FooActionFactory actionFactory;
+			{
+				World world("World1");
+				Assert::IsNull(world.Arena());
+				Sector& sector = world.CreateSector("Sector1");
+				Assert::IsTrue(&sector.GetAllocator() == &Allocator::Default());
+			}
+
+			{
+				World world("World2", true);
+				const LinearAllocator* arena = world.Arena();
+				Assert::IsNotNull(arena);
+
+				for (std::int32_t i = 0; i < 8; ++i)
+				{
+					Sector& sector = world.CreateSector("Sector" + std::to_string(i));
+					for (std::int32_t j = 0; j < 8; ++j)
+					{
+						Entity& entity = sector.CreateEntity("Entity", "Entity" + std::to_string(j));
+						entity.CreateAction("FooAction", "Action");
+						entity.AppendScope("Nested").Append("Values") = 10;
+					}
+				}
+
+				// Everything below the World, down to the values of nested scopes, comes from the arena
+				Datum& sectors = world.Sectors();
+				Assert::AreEqual(8U, sectors.Size());
+				Sector* sector = sectors[7].As<Sector>();
+				Assert::IsTrue(&sector->GetAllocator() == arena);
+				Entity* entity = sector->Entities()[7].As<Entity>();
+				Assert::IsTrue(&entity->GetAllocator() == arena);
+				Assert::IsTrue(&entity->Actions()[0].GetAllocator() == arena);
+				Assert::IsTrue(&(*entity)["Nested"][0].GetAllocator() == arena);
+				Assert::IsTrue(&world.GetAllocator() == &Allocator::Default());
+#if defined(DEBUG) | defined(_DEBUG)
+				Assert::IsTrue(arena->BytesInUse() > 0);
+#endif
+			}
+		}
+
 	private:
 #if defined(DEBUG) | defined(_DEBUG)
 		static _CrtMemState sStartMemState;
@@ -0,0 +1,180 @@
+#include "pch.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace Library;
+
+namespace UnitTestLibraryDesktop
+{
+	// Sends the first Event it is notified of around again, as a reaction firing its own event would
+	struct RequeueSubscriber final : public IEventSubscriber
+	{
+		RequeueSubscriber(EventQueue& queue, const GameTime& gameTime, const Milliseconds& delay)
+			: mQueue(queue), mGameTime(gameTime), mDelay(delay)
+		{
+		}
+
+		virtual void Notify(const EventPublisher& publisher) override
+		{
+			if (NotifyCount++ == 0)
+			{
+				mQueue.Enqueue(const_cast<EventPublisher&>(publisher), mGameTime, mDelay);
+			}
+		}
+
+		std::uint32_t NotifyCount = 0;
+
+	private:
+		EventQueue& mQueue;
+		const GameTime& mGameTime;
+		Milliseconds mDelay;
+	};
+
+	TEST_CLASS(EventPoolTest)
+	{
+	public:
+
+#if defined(DEBUG) | defined(_DEBUG)
+		TEST_METHOD_INITIALIZE(Initialize)
+		{
+			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
+			_CrtMemCheckpoint(&sStartMemState);
+		}
+
+		TEST_METHOD_CLEANUP(Cleanup)
+		{
+			_CrtMemState endMemState, diffMemState;
+			_CrtMemCheckpoint(&endMemState);
+			if (_CrtMemDifference(&diffMemState, &sStartMemState, &endMemState))
+			{
+				_CrtMemDumpStatistics(&diffMemState);
+				Assert::Fail(L"Memory Leaks!");
+			}
+		}
+#endif
+
+		TEST_METHOD(EventPoolTestAcquireRelease)
+		{
+			EventPool<Foo> pool;
+			Assert::AreEqual(0U, pool.Size());
+			Assert::AreEqual(0U, pool.AvailableCount());
+
+			Event<Foo>& first = pool.Acquire();
+			Event<Foo>& second = pool.Acquire();
+			Assert::IsTrue(&first != &second);
+			Assert::AreEqual(2U, pool.Size());
+			Assert::AreEqual(0U, pool.AvailableCount());
+
+			// A released Event is handed out again, message and all, instead of creating another
+			first.Message() = Foo(5);
+			first.Recycle();
+			Assert::AreEqual(1U, pool.AvailableCount());
+			Event<Foo>& third = pool.Acquire();
+			Assert::IsTrue(&first == &third);
+			Assert::AreEqual(5, third.Message().Data());
+			Assert::AreEqual(2U, pool.Size());
+			Assert::AreEqual(0U, pool.AvailableCount());
+
+			// Events that are not pooled have nowhere to go back to
+			Event<Foo> unpooled(Foo(1));
+			unpooled.Recycle();
+			Assert::AreEqual(0U, pool.AvailableCount());
+		}
+
+		TEST_METHOD(EventPoolTestEventQueue)
+		{
+			// Whether it is sent, delivered or cleared, a pooled Event always ends up back in its pool
+			const EventQueue::Strategy strategies[] = { EventQueue::Strategy::Heap, EventQueue::Strategy::TimingWheel };
+			for (EventQueue::Strategy strategy : strategies)
+			{
+				JobSystem jobSystem(0);
+				EventPool<Foo> pool;
+				EventQueue queue(strategy, jobSystem);
+				GameTime gameTime;
+				const auto start = std::chrono::high_resolution_clock::now();
+				gameTime.SetCurrentTime(start);
+
+				queue.Enqueue(pool.Acquire(), gameTime);
+				Assert::AreEqual(1U, pool.Size());
+				Assert::AreEqual(1U, pool.AvailableCount());
+
+				queue.Enqueue(pool.Acquire(), gameTime, Milliseconds(100));
+				queue.Enqueue(pool.Acquire(), gameTime, Milliseconds(200));
+				Assert::AreEqual(2U, pool.Size());
+				Assert::AreEqual(0U, pool.AvailableCount());
+
+				gameTime.SetCurrentTime(start + Milliseconds(150));
+				queue.Update(gameTime);
+				Assert::AreEqual(1U, pool.AvailableCount());
+
+				queue.Clear();
+				Assert::AreEqual(2U, pool.AvailableCount());
+
+				// Firing at the same rate again reuses the Events already in the pool
+				for (std::uint32_t i = 0; i < 10; ++i)
+				{
+					queue.Enqueue(pool.Acquire(), gameTime, Milliseconds(10));
+					queue.Enqueue(pool.Acquire(), gameTime, Milliseconds(10));
+					gameTime.SetCurrentTime(gameTime.CurrentTime() + Milliseconds(20));
+					queue.Update(gameTime);
+				}
+				Assert::AreEqual(2U, pool.Size());
+				Assert::AreEqual(2U, pool.AvailableCount());
+			}
+		}
+
+		TEST_METHOD(EventPoolTestRequeue)
+		{
+			// An Event enqueued again during its delivery stays out of the pool until that delivery is done too
+			JobSystem jobSystem(0);
+			EventPool<Foo> pool;
+			EventQueue queue(jobSystem);
+			GameTime gameTime;
+			const auto start = std::chrono::high_resolution_clock::now();
+			gameTime.SetCurrentTime(start);
+
+			{
+				RequeueSubscriber subscriber(queue, gameTime, Milliseconds(10));
+				Event<Foo>::Subscribe(subscriber);
+				queue.Enqueue(pool.Acquire(), gameTime, Milliseconds(10));
+				gameTime.SetCurrentTime(gameTime.CurrentTime() + Milliseconds(20));
+				queue.Update(gameTime);
+				Assert::AreEqual(1U, subscriber.NotifyCount);
+				Assert::AreEqual(1U, queue.Size());
+				Assert::AreEqual(0U, pool.AvailableCount());
+
+				gameTime.SetCurrentTime(gameTime.CurrentTime() + Milliseconds(20));
+				queue.Update(gameTime);
+				Assert::AreEqual(2U, subscriber.NotifyCount);
+				Assert::IsTrue(queue.IsEmpty());
+				Assert::AreEqual(1U, pool.AvailableCount());
+				Event<Foo>::Unsubscribe(subscriber);
+			}
+
+			{
+				// Sent straight away, and queued again from within the send
+				RequeueSubscriber subscriber(queue, gameTime, Milliseconds(10));
+				Event<Foo>::Subscribe(subscriber);
+				queue.Enqueue(pool.Acquire(), gameTime);
+				Assert::AreEqual(1U, subscriber.NotifyCount);
+				Assert::AreEqual(1U, queue.Size());
+				Assert::AreEqual(0U, pool.AvailableCount());
+
+				queue.Clear();
+				Assert::AreEqual(1U, pool.AvailableCount());
+				Assert::AreEqual(1U, pool.Size());
+				Event<Foo>::Unsubscribe(subscriber);
+			}
+		}
+
+		private:
+#if defined(DEBUG) | defined(_DEBUG)
+			static _CrtMemState sStartMemState;
+#endif
+
+	};
+
+#if defined(DEBUG) | defined(_DEBUG)
+	_CrtMemState EventPoolTest::sStartMemState;
+#endif
+
+}
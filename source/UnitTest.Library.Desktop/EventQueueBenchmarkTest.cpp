@@ -0,0 +1,69 @@
+#include "pch.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace Library;
+using namespace std::chrono;
+
+namespace UnitTestLibraryDesktop
+{
+	TEST_CLASS(EventQueueBenchmark)
+	{
+	public:
+		// Timings are only meaningful in a Release build, so the benchmark is run by hand
+		BEGIN_TEST_METHOD_ATTRIBUTE(EventQueueBenchmarkStrategies)
+			TEST_IGNORE()
+		END_TEST_METHOD_ATTRIBUTE()
+
+		TEST_METHOD(EventQueueBenchmarkStrategies)
+		{
+			const std::uint32_t counts[] = { 1000, 100000, 1000000 };
+			const EventQueue::Strategy strategies[] = { EventQueue::Strategy::Heap, EventQueue::Strategy::TimingWheel };
+			const wchar_t* names[] = { L"heap", L"timing wheel" };
+
+			for (std::uint32_t count : counts)
+			{
+				for (std::uint32_t i = 0; i < 2; ++i)
+				{
+					double enqueueTime;
+					double updateTime;
+					Run(strategies[i], count, enqueueTime, updateTime);
+
+					wchar_t message[128];
+					swprintf_s(message, L"%8u events, %-12s enqueue %8.2f ms, expire %8.2f ms\n", count, names[i], enqueueTime, updateTime);
+					Logger::WriteMessage(message);
+				}
+			}
+		}
+
+	private:
+		static void Run(const EventQueue::Strategy strategy, const std::uint32_t count, double& enqueueTime, double& updateTime)
+		{
+			// Short millisecond delays, delivered inline so only the queue itself is measured
+			JobSystem jobSystem(0);
+			EventQueue queue(strategy, jobSystem);
+			Vector<IEventSubscriber*> subscribers;
+			EventPublisher publisher(subscribers);
+
+			GameTime gameTime;
+			gameTime.SetCurrentTime(high_resolution_clock::now());
+			std::uint64_t random = 42;
+
+			auto begin = high_resolution_clock::now();
+			for (std::uint32_t i = 0; i < count; ++i)
+			{
+				random = random * 6364136223846793005ULL + 1442695040888963407ULL;
+				queue.Enqueue(publisher, gameTime, Milliseconds(1 + (random >> 33) % 1000));
+			}
+			enqueueTime = duration<double, std::milli>(high_resolution_clock::now() - begin).count();
+
+			// Sixty frames a second until everything has been delivered
+			begin = high_resolution_clock::now();
+			while (!queue.IsEmpty())
+			{
+				gameTime.SetCurrentTime(gameTime.CurrentTime() + milliseconds(16));
+				queue.Update(gameTime);
+			}
+			updateTime = duration<double, std::milli>(high_resolution_clock::now() - begin).count();
+		}
+	};
+}
@@ -5,6 +5,42 @@ using namespace Library;
 
 namespace UnitTestLibraryDesktop
 {
+	struct SlowSubscriber final : public IEventSubscriber
+	{
+		virtual void Notify(const EventPublisher& publisher) override
+		{
+			UNREFERENCED_PARAMETER(publisher);
+			std::this_thread::sleep_for(Milliseconds(2));
+			++NotifyCount;
+		}
+
+		std::atomic<std::uint32_t> NotifyCount = { 0 };
+	};
+
+	struct OverlapSubscriber final : public IEventSubscriber
+	{
+		virtual void Notify(const EventPublisher& publisher) override
+		{
+			UNREFERENCED_PARAMETER(publisher);
+		}
+
+		virtual void NotifyBatch(const Span<const EventPublisher* const> publishers) override
+		{
+			UNREFERENCED_PARAMETER(publishers);
+			if (++ActiveCount > 1)
+			{
+				WasOverlapped = true;
+			}
+			std::this_thread::sleep_for(Milliseconds(5));
+			--ActiveCount;
+			++BatchCount;
+		}
+
+		std::atomic<std::uint32_t> ActiveCount = { 0 };
+		std::atomic<std::uint32_t> BatchCount = { 0 };
+		std::atomic<bool> WasOverlapped = { false };
+	};
+
 	TEST_CLASS(EventTest)
 	{
 	public:
@@ -97,6 +133,426 @@ namespace UnitTestLibraryDesktop
 			queue.Update(worldState.GetGameTime());
 		}
 
+		TEST_METHOD(EventTestEventQueueJobSystem)
+		{
+			JobSystem jobSystem(3);
+			FooSubscriber subscriber;
+			Vector<IEventSubscriber*> subscribers;
+			for (std::uint32_t i = 0; i < 50; ++i)
+			{
+				subscribers.PushBack(&subscriber);
+			}
+
+			GameTime gameTime;
+			gameTime.SetCurrentTime(std::chrono::high_resolution_clock::now());
+			EventQueue queue(jobSystem);
+			Vector<EventPublisher*> publishers;
+			for (std::uint32_t i = 0; i < 30; ++i)
+			{
+				publishers.PushBack(new EventPublisher(subscribers));
+				queue.Enqueue(*publishers.Back(), gameTime, Milliseconds(i < 20 ? 1 : 60000));
+			}
+
+			// Expired events are fanned out over the workers and finished by the time Update returns
+			gameTime.SetCurrentTime(gameTime.CurrentTime() + Milliseconds(10));
+			queue.Update(gameTime);
+			Assert::AreEqual(20U * 50U, subscriber.NotifyCount.load());
+			Assert::AreEqual(10U, queue.Size());
+
+			// Send skips the queue but still fans out over the workers
+			queue.Send(*publishers.Front());
+			Assert::AreEqual(21U * 50U, subscriber.NotifyCount.load());
+
+			for (EventPublisher* publisher : publishers)
+			{
+				delete publisher;
+			}
+		}
+
+		TEST_METHOD(EventTestEventQueueExpiryOrder)
+		{
+			// Both strategies hand out events in the order they expire
+			const EventQueue::Strategy strategies[] = { EventQueue::Strategy::Heap, EventQueue::Strategy::TimingWheel };
+			for (EventQueue::Strategy strategy : strategies)
+			{
+				FooSubscriber subscribers[4];
+				Vector<IEventSubscriber*> subscriberLists[4];
+				Vector<EventPublisher*> publishers;
+				for (std::uint32_t i = 0; i < 4; ++i)
+				{
+					subscriberLists[i].PushBack(&subscribers[i]);
+					publishers.PushBack(new EventPublisher(subscriberLists[i]));
+				}
+
+				GameTime gameTime;
+				const auto start = std::chrono::high_resolution_clock::now();
+				gameTime.SetCurrentTime(start);
+				EventQueue queue(strategy);
+				Assert::IsTrue(queue.GetStrategy() == strategy);
+				Assert::IsTrue(queue.NextExpiryTime() == EventQueue::TimePoint::max());
+
+				// Enqueued out of order, the soonest event is always the next to expire
+				const std::uint32_t delays[] = { 300, 100, 400, 200 };
+				for (std::uint32_t i = 0; i < 4; ++i)
+				{
+					queue.Enqueue(*publishers[i], gameTime, Milliseconds(delays[i]));
+				}
+				Assert::IsTrue(queue.NextExpiryTime() == start + Milliseconds(100));
+
+				// An event is not delivered until its expiry time has passed
+				gameTime.SetCurrentTime(start + Milliseconds(100));
+				queue.Update(gameTime);
+				Assert::AreEqual(4U, queue.Size());
+
+				gameTime.SetCurrentTime(start + Milliseconds(250));
+				queue.Update(gameTime);
+				Assert::AreEqual(2U, queue.Size());
+				Assert::AreEqual(0U, subscribers[0].NotifyCount.load());
+				Assert::AreEqual(1U, subscribers[1].NotifyCount.load());
+				Assert::AreEqual(0U, subscribers[2].NotifyCount.load());
+				Assert::AreEqual(1U, subscribers[3].NotifyCount.load());
+				Assert::IsTrue(queue.NextExpiryTime() == start + Milliseconds(300));
+
+				gameTime.SetCurrentTime(start + Milliseconds(500));
+				queue.Update(gameTime);
+				Assert::IsTrue(queue.IsEmpty());
+				Assert::AreEqual(1U, subscribers[0].NotifyCount.load());
+				Assert::AreEqual(1U, subscribers[2].NotifyCount.load());
+				Assert::IsTrue(queue.NextExpiryTime() == EventQueue::TimePoint::max());
+
+				for (EventPublisher* publisher : publishers)
+				{
+					delete publisher;
+				}
+			}
+		}
+
+		TEST_METHOD(EventTestEventQueueProducers)
+		{
+			JobSystem jobSystem(3);
+			FooSubscriber subscriber;
+			Vector<IEventSubscriber*> subscribers;
+			subscribers.PushBack(&subscriber);
+
+			const std::uint32_t count = 400;
+			Vector<EventPublisher*> publishers;
+			for (std::uint32_t i = 0; i < count; ++i)
+			{
+				publishers.PushBack(new EventPublisher(subscribers));
+			}
+
+			GameTime gameTime;
+			gameTime.SetCurrentTime(std::chrono::high_resolution_clock::now());
+			EventQueue queue(jobSystem);
+
+			// Jobs enqueue at the same time without taking a lock
+			jobSystem.ParallelFor(count, 1, [&queue, &publishers, &gameTime](std::uint32_t begin, std::uint32_t end)
+			{
+				for (std::uint32_t i = begin; i < end; ++i)
+				{
+					queue.Enqueue(*publishers[i], gameTime, Milliseconds(1 + i % 2));
+				}
+			});
+			Assert::AreEqual(count, queue.Size());
+
+			gameTime.SetCurrentTime(gameTime.CurrentTime() + Milliseconds(1) + std::chrono::microseconds(1));
+			queue.Update(gameTime);
+			Assert::AreEqual(count / 2, subscriber.NotifyCount.load());
+			Assert::AreEqual(count / 2, queue.Size());
+
+			queue.Clear();
+			Assert::IsTrue(queue.IsEmpty());
+
+			for (EventPublisher* publisher : publishers)
+			{
+				delete publisher;
+			}
+		}
+
+		TEST_METHOD(EventTestEventQueueBatchDelivery)
+		{
+			JobSystem jobSystem(2);
+			FooSubscriber first;
+			FooSubscriber shared;
+			FooSubscriber second;
+			SubscriberList firstSubscribers;
+			SubscriberList secondSubscribers;
+			firstSubscribers.Add(first);
+			firstSubscribers.Add(shared);
+			secondSubscribers.Add(shared);
+			secondSubscribers.Add(second);
+
+			// Two types of event, enqueued interleaved and out of order
+			EventPublisher firstA(firstSubscribers), firstB(firstSubscribers), firstC(firstSubscribers);
+			EventPublisher secondA(secondSubscribers), secondB(secondSubscribers);
+			GameTime gameTime;
+			const auto start = std::chrono::high_resolution_clock::now();
+			gameTime.SetCurrentTime(start);
+			EventQueue queue(jobSystem);
+			Assert::IsFalse(queue.IsBatchDelivery());
+			queue.SetBatchDelivery(true);
+			Assert::IsTrue(queue.IsBatchDelivery());
+
+			queue.Enqueue(firstA, gameTime, Milliseconds(30));
+			queue.Enqueue(secondA, gameTime, Milliseconds(15));
+			queue.Enqueue(firstB, gameTime, Milliseconds(10));
+			queue.Enqueue(secondB, gameTime, Milliseconds(5));
+			queue.Enqueue(firstC, gameTime, Milliseconds(20));
+
+			// Each subscriber gets every event of a type in one batch, soonest first
+			gameTime.SetCurrentTime(start + Milliseconds(50));
+			queue.Update(gameTime);
+			Assert::IsTrue(queue.IsEmpty());
+			Assert::AreEqual(1U, first.BatchCount.load());
+			Assert::AreEqual(3U, first.NotifyCount.load());
+			Assert::AreEqual(3U, first.LastBatchSize.load());
+			Assert::IsTrue(first.LastBatchFront.load() == &firstB);
+			Assert::AreEqual(1U, second.BatchCount.load());
+			Assert::AreEqual(2U, second.NotifyCount.load());
+			Assert::AreEqual(2U, second.LastBatchSize.load());
+			Assert::IsTrue(second.LastBatchFront.load() == &secondB);
+			Assert::AreEqual(2U, shared.BatchCount.load());
+			Assert::AreEqual(5U, shared.NotifyCount.load());
+
+			// Delivered one at a time, the subscribers only see Notify
+			queue.SetBatchDelivery(false);
+			queue.Enqueue(firstA, gameTime, Milliseconds(10));
+			gameTime.SetCurrentTime(start + Milliseconds(100));
+			queue.Update(gameTime);
+			Assert::AreEqual(1U, first.BatchCount.load());
+			Assert::AreEqual(4U, first.NotifyCount.load());
+		}
+
+		TEST_METHOD(EventTestEventQueueBatchPerSubscriber)
+		{
+			// A subscriber of several event types gets all of its batches in one job, never on two threads at once
+			JobSystem jobSystem(3);
+			OverlapSubscriber shared;
+			SubscriberList subscriberLists[4];
+			Vector<EventPublisher*> publishers;
+			for (SubscriberList& subscribers : subscriberLists)
+			{
+				subscribers.Add(shared);
+				publishers.PushBack(new EventPublisher(subscribers));
+			}
+
+			GameTime gameTime;
+			const auto start = std::chrono::high_resolution_clock::now();
+			gameTime.SetCurrentTime(start);
+			EventQueue queue(jobSystem);
+			queue.SetBatchDelivery(true);
+			for (EventPublisher* publisher : publishers)
+			{
+				queue.Enqueue(*publisher, gameTime, Milliseconds(10));
+			}
+
+			gameTime.SetCurrentTime(start + Milliseconds(20));
+			queue.Update(gameTime);
+			Assert::IsTrue(queue.IsEmpty());
+			Assert::AreEqual(4U, shared.BatchCount.load());
+			Assert::IsFalse(shared.WasOverlapped.load());
+
+			// With a time budget, slices hold whole batches, and what the time ran out on keeps its place
+			queue.SetDeliveryBudget(0, Milliseconds(1));
+			for (EventPublisher* publisher : publishers)
+			{
+				queue.Enqueue(*publisher, gameTime, Milliseconds(10));
+			}
+			gameTime.SetCurrentTime(start + Milliseconds(40));
+			while (!queue.IsEmpty())
+			{
+				queue.Update(gameTime);
+			}
+			Assert::AreEqual(8U, shared.BatchCount.load());
+			Assert::IsFalse(shared.WasOverlapped.load());
+
+			for (EventPublisher* publisher : publishers)
+			{
+				delete publisher;
+			}
+		}
+
+		TEST_METHOD(EventTestEventQueueDeliveryBudget)
+		{
+			// With either strategy, a burst is spread over several Updates without losing its order
+			const EventQueue::Strategy strategies[] = { EventQueue::Strategy::Heap, EventQueue::Strategy::TimingWheel };
+			for (EventQueue::Strategy strategy : strategies)
+			{
+				JobSystem jobSystem(2);
+				FooSubscriber subscribers[10];
+				Vector<IEventSubscriber*> subscriberLists[10];
+				Vector<EventPublisher*> publishers;
+				for (std::uint32_t i = 0; i < 10; ++i)
+				{
+					subscriberLists[i].PushBack(&subscribers[i]);
+					publishers.PushBack(new EventPublisher(subscriberLists[i]));
+				}
+
+				GameTime gameTime;
+				const auto start = std::chrono::high_resolution_clock::now();
+				gameTime.SetCurrentTime(start);
+				EventQueue queue(strategy, jobSystem);
+				queue.SetDeliveryBudget(4);
+				Assert::AreEqual(4U, queue.MaxEventsPerUpdate());
+				Assert::IsTrue(queue.MaxTimePerUpdate() == Milliseconds(0));
+				for (std::uint32_t i = 10; i > 0; --i)
+				{
+					queue.Enqueue(*publishers[i - 1], gameTime, Milliseconds(i));
+				}
+
+				gameTime.SetCurrentTime(start + Milliseconds(50));
+				const std::uint32_t expectedSizes[] = { 6, 2, 0 };
+				for (std::uint32_t update = 0; update < 3; ++update)
+				{
+					queue.Update(gameTime);
+					Assert::AreEqual(expectedSizes[update], queue.Size());
+					for (std::uint32_t i = 0; i < 10; ++i)
+					{
+						Assert::AreEqual(i < 10 - expectedSizes[update] ? 1U : 0U, subscribers[i].NotifyCount.load());
+					}
+					Assert::IsTrue(queue.IsEmpty() ? queue.NextExpiryTime() == EventQueue::TimePoint::max() : queue.NextExpiryTime() < gameTime.CurrentTime());
+				}
+
+				for (EventPublisher* publisher : publishers)
+				{
+					delete publisher;
+				}
+			}
+		}
+
+		TEST_METHOD(EventTestEventQueueTimeBudget)
+		{
+			// Without workers, a slice is EventsPerJob events, which take longer than the budget to deliver
+			JobSystem jobSystem(0);
+			SlowSubscriber subscriber;
+			Vector<IEventSubscriber*> subscribers;
+			subscribers.PushBack(&subscriber);
+			Vector<EventPublisher*> publishers;
+			for (std::uint32_t i = 0; i < 10; ++i)
+			{
+				publishers.PushBack(new EventPublisher(subscribers));
+			}
+
+			GameTime gameTime;
+			gameTime.SetCurrentTime(std::chrono::high_resolution_clock::now());
+			EventQueue queue(jobSystem);
+			queue.SetDeliveryBudget(0, Milliseconds(1));
+			for (EventPublisher* publisher : publishers)
+			{
+				queue.Enqueue(*publisher, gameTime, Milliseconds(1));
+			}
+
+			gameTime.SetCurrentTime(gameTime.CurrentTime() + Milliseconds(10));
+			queue.Update(gameTime);
+			const std::uint32_t sliceSize = EventQueue::EventsPerJob;
+			Assert::AreEqual(sliceSize, subscriber.NotifyCount.load());
+			Assert::AreEqual(10U - sliceSize, queue.Size());
+
+			queue.SetDeliveryBudget(0);
+			queue.Update(gameTime);
+			Assert::AreEqual(10U, subscriber.NotifyCount.load());
+			Assert::IsTrue(queue.IsEmpty());
+
+			for (EventPublisher* publisher : publishers)
+			{
+				delete publisher;
+			}
+		}
+
+		TEST_METHOD(EventTestEventQueueConcurrentUpdate)
+		{
+			// Each Update delivers its slice outside the lock, so two threads updating at once must each keep their own
+			const bool batchModes[] = { false, true };
+			for (bool isBatched : batchModes)
+			{
+				JobSystem jobSystem(2);
+				SlowSubscriber subscriber;
+				Vector<IEventSubscriber*> subscribers;
+				subscribers.PushBack(&subscriber);
+
+				const std::uint32_t count = 100;
+				Vector<EventPublisher*> publishers;
+				for (std::uint32_t i = 0; i < count; ++i)
+				{
+					publishers.PushBack(new EventPublisher(subscribers));
+				}
+
+				GameTime gameTime;
+				const auto start = std::chrono::high_resolution_clock::now();
+				gameTime.SetCurrentTime(start);
+				EventQueue queue(jobSystem);
+				queue.SetBatchDelivery(isBatched);
+				queue.SetDeliveryBudget(8);
+				for (std::uint32_t i = 0; i < count; ++i)
+				{
+					queue.Enqueue(*publishers[i], gameTime, Milliseconds(1 + i % 10));
+				}
+
+				gameTime.SetCurrentTime(start + Milliseconds(50));
+				auto update = [&queue, &gameTime]
+				{
+					while (!queue.IsEmpty())
+					{
+						queue.Update(gameTime);
+					}
+				};
+				std::future<void> other = std::async(std::launch::async, update);
+				update();
+				other.get();
+
+				// Every event was delivered by exactly one of the two threads
+				Assert::AreEqual(count, subscriber.NotifyCount.load());
+				Assert::IsTrue(queue.NextExpiryTime() == EventQueue::TimePoint::max());
+
+				for (EventPublisher* publisher : publishers)
+				{
+					delete publisher;
+				}
+			}
+		}
+
+		TEST_METHOD(EventTestEventQueueHighWaterMark)
+		{
+			JobSystem jobSystem(0);
+			FooSubscriber subscriber;
+			SubscriberList subscribers;
+			subscribers.Add(subscriber);
+			EventPublisher first(subscribers), second(subscribers), third(subscribers);
+			EventPool<Foo> pool;
+
+			GameTime gameTime;
+			gameTime.SetCurrentTime(std::chrono::high_resolution_clock::now());
+			EventQueue queue(jobSystem);
+			Assert::AreEqual(0U, queue.HighWaterMark());
+			queue.SetHighWaterMark(2);
+			Assert::AreEqual(2U, queue.HighWaterMark());
+
+			Assert::IsTrue(queue.Enqueue(first, gameTime, Milliseconds(1)));
+			Assert::IsFalse(queue.IsAtHighWaterMark());
+			Assert::IsTrue(queue.Enqueue(second, gameTime, Milliseconds(1)));
+			Assert::IsTrue(queue.IsAtHighWaterMark());
+
+			// Full, the queue turns events away, and pooled ones go straight back to their pool
+			Assert::IsFalse(queue.Enqueue(third, gameTime, Milliseconds(1)));
+			Assert::IsFalse(queue.Enqueue(pool.Acquire(), gameTime, Milliseconds(1)));
+			Assert::AreEqual(1U, pool.AvailableCount());
+			Assert::AreEqual(2U, queue.Size());
+
+			// Sending bypasses the queue, so it is never turned away
+			Assert::IsTrue(queue.Enqueue(third, gameTime));
+			Assert::AreEqual(1U, subscriber.NotifyCount.load());
+
+			gameTime.SetCurrentTime(gameTime.CurrentTime() + Milliseconds(10));
+			queue.Update(gameTime);
+			Assert::IsFalse(queue.IsAtHighWaterMark());
+			Assert::IsTrue(queue.Enqueue(third, gameTime, Milliseconds(1)));
+
+			queue.SetHighWaterMark(0);
+			Assert::IsTrue(queue.Enqueue(first, gameTime, Milliseconds(1)));
+			Assert::IsTrue(queue.Enqueue(second, gameTime, Milliseconds(1)));
+			Assert::AreEqual(3U, queue.Size());
+		}
+
 		TEST_METHOD(EventTestEventQueueClear)
 		{
 			Library::WorldState worldState;
@@ -145,6 +601,71 @@ namespace UnitTestLibraryDesktop
 			fooEvent.UnsubscribeAll();
 		}
 
+		TEST_METHOD(EventTestSubscriberListSnapshot)
+		{
+			FooSubscriber first;
+			FooSubscriber second;
+			SubscriberList subscribers;
+			Assert::AreEqual(0U, subscribers.Size());
+			Assert::IsTrue(subscribers.GetSnapshot() == nullptr);
+
+			// A snapshot keeps the subscribers it was taken with
+			subscribers.Add(first);
+			SubscriberList::Snapshot snapshot = subscribers.GetSnapshot();
+			subscribers.Add(second);
+			Assert::AreEqual(1U, snapshot->Size());
+			Assert::AreEqual(2U, subscribers.Size());
+
+			subscribers.Remove(first);
+			Assert::AreEqual(1U, subscribers.Size());
+			Assert::IsTrue(subscribers.GetSnapshot()->Front() == &second);
+			Assert::IsTrue(snapshot->Front() == &first);
+
+			// A publisher delivers to whoever is subscribed when it is delivered
+			JobSystem jobSystem(0);
+			EventPublisher publisher(subscribers);
+			publisher.Deliver(jobSystem);
+			Assert::AreEqual(0U, first.NotifyCount.load());
+			Assert::AreEqual(1U, second.NotifyCount.load());
+
+			subscribers.Clear();
+			Assert::AreEqual(0U, subscribers.Size());
+			publisher.Deliver(jobSystem);
+			Assert::AreEqual(1U, second.NotifyCount.load());
+		}
+
+		TEST_METHOD(EventTestSubscriberListConcurrentDelivery)
+		{
+			// Deliveries carry on while the list changes underneath them
+			const std::uint32_t DeliveryCount = 1000;
+			FooSubscriber steady;
+			FooSubscriber transient;
+			SubscriberList subscribers;
+			subscribers.Add(steady);
+			EventPublisher publisher(subscribers);
+
+			std::atomic<bool> isDelivering(true);
+			std::thread deliverer([&]
+			{
+				JobSystem jobSystem(0);
+				for (std::uint32_t i = 0; i < DeliveryCount; ++i)
+				{
+					publisher.Deliver(jobSystem);
+				}
+				isDelivering = false;
+			});
+
+			while (isDelivering)
+			{
+				subscribers.Add(transient);
+				subscribers.Remove(transient);
+			}
+			deliverer.join();
+
+			Assert::AreEqual(DeliveryCount, steady.NotifyCount.load());
+			Assert::AreEqual(1U, subscribers.Size());
+		}
+
 		TEST_METHOD(EventTestEventMessage)
 		{
 			Foo f;
@@ -6,13 +6,35 @@ namespace UnitTestLibraryDesktop
 	RTTI_DEFINITIONS(FooAction)
 
 	FooAction::FooAction(const std::string& name)
-		: Action(name)
+		: Action(name), mIsParallelSafe(true), mUpdateCount(0), mLastThread()
 	{
 	}
 
 	void FooAction::Update(Library::WorldState& state)
 	{
 		UNREFERENCED_PARAMETER(state);
+		++mUpdateCount;
+		mLastThread = std::this_thread::get_id();
+	}
+
+	bool FooAction::IsParallelSafe() const
+	{
+		return mIsParallelSafe;
+	}
+
+	void FooAction::SetParallelSafe(const bool isParallelSafe)
+	{
+		mIsParallelSafe = isParallelSafe;
+	}
+
+	std::uint32_t FooAction::UpdateCount() const
+	{
+		return mUpdateCount;
+	}
+
+	std::thread::id FooAction::LastThread() const
+	{
+		return mLastThread;
 	}
 
 }
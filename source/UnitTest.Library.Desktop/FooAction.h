@@ -1,6 +1,8 @@
 #pragma once
 
 #include <string>
+#include <atomic>
+#include <thread>
 #include "Action.h"
 #include "Factory.h"
 
@@ -17,6 +19,15 @@ namespace UnitTestLibraryDesktop
 		FooAction(const std::string& name = "");
 		virtual ~FooAction() = default;
 		virtual void Update(Library::WorldState& state) override;
+		virtual bool IsParallelSafe() const override;
+		void SetParallelSafe(const bool isParallelSafe);
+		std::uint32_t UpdateCount() const;
+		std::thread::id LastThread() const;
+
+	private:
+		bool mIsParallelSafe;
+		std::atomic<std::uint32_t> mUpdateCount;
+		std::thread::id mLastThread;
 	};
 
 	ActionFactory(FooAction)
@@ -0,0 +1,31 @@
+#include "pch.h"
+#include "FooParticle.h"
+
+namespace UnitTestLibraryDesktop
+{
+	RTTI_DEFINITIONS(FooParticle)
+
+	FooParticle::FooParticle(const glm::vec4& position, const glm::vec4& velocity)
+		: mPosition(position), mVelocity(velocity)
+	{
+		AddExternalSignature("position", 1, &mPosition);
+		AddExternalSignature("velocity", 1, &mVelocity);
+		Populate();
+	}
+
+	FooParticle::FooParticle(FooParticle&& rhs)
+		: Attributed(std::move(rhs)), mPosition(rhs.mPosition), mVelocity(rhs.mVelocity)
+	{
+		MoveExternalStorage(rhs, sizeof(FooParticle));
+	}
+
+	const glm::vec4& FooParticle::Position() const
+	{
+		return mPosition;
+	}
+
+	const glm::vec4& FooParticle::Velocity() const
+	{
+		return mVelocity;
+	}
+}
@@ -0,0 +1,26 @@
+#pragma once
+
+#include "RTTI.h"
+#include "Attributed.h"
+
+using namespace Library;
+
+namespace UnitTestLibraryDesktop
+{
+	class FooParticle final : public Attributed
+	{
+		RTTI_DECLARATIONS(FooParticle, Attributed)
+
+	public:
+		FooParticle(const glm::vec4& position = glm::vec4(0.0f), const glm::vec4& velocity = glm::vec4(0.0f));
+		FooParticle(FooParticle&& rhs);
+		virtual ~FooParticle() = default;
+
+		const glm::vec4& Position() const;
+		const glm::vec4& Velocity() const;
+
+	private:
+		glm::vec4 mPosition;
+		glm::vec4 mVelocity;
+	};
+}
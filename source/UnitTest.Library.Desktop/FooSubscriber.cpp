@@ -5,7 +5,7 @@ namespace UnitTestLibraryDesktop
 {
 
 	FooSubscriber::FooSubscriber()
-		: WasMessageReceived(false)
+		: WasMessageReceived(false), NotifyCount(0), BatchCount(0), LastBatchFront(nullptr), LastBatchSize(0)
 	{
 	}
 
@@ -13,6 +13,15 @@ namespace UnitTestLibraryDesktop
 	{
 		UNREFERENCED_PARAMETER(publisher);
 		WasMessageReceived = true;
+		++NotifyCount;
+	}
+
+	void FooSubscriber::NotifyBatch(const Library::Span<const Library::EventPublisher* const> publishers)
+	{
+		++BatchCount;
+		LastBatchFront = publishers[0];
+		LastBatchSize = publishers.Size();
+		IEventSubscriber::NotifyBatch(publishers);
 	}
 
 }
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <atomic>
 #include "IEventSubscriber.h"
 
 namespace UnitTestLibraryDesktop
@@ -12,6 +13,11 @@ namespace UnitTestLibraryDesktop
 		FooSubscriber();
 		virtual ~FooSubscriber() = default;
 		virtual void Notify(const Library::EventPublisher& publisher);
+		virtual void NotifyBatch(const Library::Span<const Library::EventPublisher* const> publishers) override;
 		bool WasMessageReceived;
+		std::atomic<std::uint32_t> NotifyCount;
+		std::atomic<std::uint32_t> BatchCount;
+		std::atomic<const Library::EventPublisher*> LastBatchFront;
+		std::atomic<std::uint32_t> LastBatchSize;
 	};
 }
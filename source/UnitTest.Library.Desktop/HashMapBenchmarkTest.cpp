@@ -0,0 +1,116 @@
+#include "pch.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace Library;
+using namespace std::chrono;
+
+namespace UnitTestLibraryDesktop
+{
+	TEST_CLASS(HashMapBenchmark)
+	{
+	public:
+		// Timings are only meaningful in a Release build, so the benchmark is run by hand
+		BEGIN_TEST_METHOD_ATTRIBUTE(HashMapBenchmarkAttributeNames)
+			TEST_IGNORE()
+		END_TEST_METHOD_ATTRIBUTE()
+
+		TEST_METHOD(HashMapBenchmarkAttributeNames)
+		{
+			// Short names like an Entity's own attributes, and long ones sharing a path-like prefix
+			std::vector<std::string> shortNames;
+			std::vector<std::string> prefixedNames;
+			for (std::uint32_t i = 0; i < 1000; ++i)
+			{
+				shortNames.push_back("attr" + std::to_string(i));
+				prefixedNames.push_back("sectors.entities.attribute" + std::to_string(i));
+			}
+
+			const std::vector<std::string>* keySets[] = { &shortNames, &prefixedNames };
+			const wchar_t* keySetNames[] = { L"short", L"prefixed" };
+			for (std::uint32_t i = 0; i < 2; ++i)
+			{
+				Report(keySetNames[i], L"shift-xor", *keySets[i], ShiftXorHash());
+				Report(keySetNames[i], L"DefaultHash", *keySets[i], DefaultHash<std::string>());
+			}
+
+			// Inserting and finding the names through a HashMap, as Scope does
+			for (std::uint32_t i = 0; i < 2; ++i)
+			{
+				const std::vector<std::string>& keys = *keySets[i];
+				const auto begin = high_resolution_clock::now();
+				std::uint32_t found = 0;
+				for (std::uint32_t round = 0; round < Rounds / 10; ++round)
+				{
+					HashMap<std::string, std::uint32_t> map(static_cast<std::uint32_t>(keys.size()));
+					for (std::uint32_t key = 0; key < keys.size(); ++key)
+					{
+						map.Insert(std::make_pair(keys[key], key));
+					}
+					for (const std::string& key : keys)
+					{
+						found += (map.Find(key) != map.end() ? 1 : 0);
+					}
+				}
+				const double time = duration<double, std::milli>(high_resolution_clock::now() - begin).count();
+
+				wchar_t message[128];
+				swprintf_s(message, L"%-8s HashMap insert + find %8.2f ms (%u found)\n", keySetNames[i], time, found);
+				Logger::WriteMessage(message);
+			}
+		}
+
+	private:
+		static const std::uint32_t Rounds = 1000;		/**< How many times each key set is hashed */
+		static const std::uint32_t BucketCount = 1024;	/**< The buckets the keys are spread over */
+
+		// The hash DefaultHash used before, kept as the baseline to compare against
+		struct ShiftXorHash
+		{
+			std::uint32_t operator()(const std::string& key) const
+			{
+				std::uint32_t hash = 0;
+				for (char c : key)
+				{
+					hash = hash << 1 ^ static_cast<std::uint8_t>(c);
+				}
+				return hash;
+			}
+		};
+
+		template<typename HashT>
+		static void Report(const wchar_t* keySetName, const wchar_t* hashName, const std::vector<std::string>& keys, HashT hash)
+		{
+			// Distribution: how many buckets are used, and how crowded the worst one is
+			std::vector<std::uint32_t> buckets(BucketCount, 0);
+			for (const std::string& key : keys)
+			{
+				++buckets[hash(key) % BucketCount];
+			}
+			std::uint32_t usedBuckets = 0;
+			std::uint32_t largestBucket = 0;
+			for (std::uint32_t count : buckets)
+			{
+				usedBuckets += (count > 0 ? 1 : 0);
+				largestBucket = (count > largestBucket ? count : largestBucket);
+			}
+
+			// Throughput: the sum keeps the hashing from being optimized away
+			std::uint32_t sum = 0;
+			const auto begin = high_resolution_clock::now();
+			for (std::uint32_t round = 0; round < Rounds; ++round)
+			{
+				for (const std::string& key : keys)
+				{
+					sum += hash(key);
+				}
+			}
+			const double time = duration<double, std::nano>(high_resolution_clock::now() - begin).count();
+			const double nanosecondsPerKey = time / (static_cast<double>(Rounds) * keys.size());
+
+			wchar_t message[160];
+			swprintf_s(message, L"%-8s %-11s %4u/%u buckets used, largest %2u, %6.2f ns/key (%08x)\n",
+				keySetName, hashName, usedBuckets, BucketCount, largestBucket, nanosecondsPerKey, sum);
+			Logger::WriteMessage(message);
+		}
+	};
+}
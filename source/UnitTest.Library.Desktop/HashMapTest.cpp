@@ -876,6 +876,198 @@ namespace UnitTestLibraryDesktop
 			Assert::IsFalse(fooKeyHashMap.end() == fooKeyHashMap.begin());
 		}
 
+		TEST_METHOD(HashMapTestCopyAndMove)
+		{
+			HashMap<std::string, std::int32_t> stringKeyHashMap(3);
+			std::string stringKeyData[] = { "zero", "one", "two", "three", "four", "five" };
+			for (std::int32_t i = 0; i < 6; ++i)
+			{
+				stringKeyHashMap.Insert(HashMap<std::string, std::int32_t>::PairType(stringKeyData[i], i));
+			}
+
+			// Test the copy constructor
+			HashMap<std::string, std::int32_t> copiedHashMap(stringKeyHashMap);
+			Assert::AreEqual(stringKeyHashMap.Size(), copiedHashMap.Size());
+			for (std::int32_t i = 0; i < 6; ++i)
+			{
+				Assert::AreEqual(i, copiedHashMap[stringKeyData[i]]);
+			}
+
+			// Test the assignment operator
+			HashMap<std::string, std::int32_t> assignedHashMap(2);
+			assignedHashMap = copiedHashMap;
+			Assert::AreEqual(6U, assignedHashMap.Size());
+			Assert::IsTrue(assignedHashMap.ContainsKey("five"));
+
+			// Test the move constructor
+			HashMap<std::string, std::int32_t> movedHashMap(std::move(copiedHashMap));
+			Assert::AreEqual(6U, movedHashMap.Size());
+			Assert::AreEqual(0U, copiedHashMap.Size());
+			Assert::IsTrue(copiedHashMap.begin() == copiedHashMap.end());
+			Assert::IsFalse(copiedHashMap.ContainsKey("zero"));
+			Assert::IsTrue(movedHashMap.ContainsKey("zero"));
+
+			// Test the move assignment operator
+			assignedHashMap = std::move(movedHashMap);
+			Assert::AreEqual(6U, assignedHashMap.Size());
+			Assert::AreEqual(3, assignedHashMap["three"]);
+		}
+
+		TEST_METHOD(HashMapTestManyEntries)
+		{
+			// The table grows as it fills and removal shifts entries back, so every key must stay reachable
+			HashMap<std::int32_t, std::int32_t> intKeyHashMap(2);
+			for (std::int32_t i = 0; i < 1000; ++i)
+			{
+				intKeyHashMap.Insert(HashMap<std::int32_t, std::int32_t>::PairType(i, i * 2));
+			}
+			Assert::AreEqual(1000U, intKeyHashMap.Size());
+			Assert::IsTrue(intKeyHashMap.Capacity() >= intKeyHashMap.Size());
+
+			for (std::int32_t i = 0; i < 1000; i += 2)
+			{
+				intKeyHashMap.Remove(i);
+			}
+			Assert::AreEqual(500U, intKeyHashMap.Size());
+
+			for (std::int32_t i = 0; i < 1000; ++i)
+			{
+				Assert::AreEqual((i % 2) != 0, intKeyHashMap.ContainsKey(i));
+			}
+
+			std::uint32_t elementCount = 0;
+			for (const auto& pair : intKeyHashMap)
+			{
+				Assert::AreEqual(pair.first * 2, pair.second);
+				++elementCount;
+			}
+			Assert::AreEqual(500U, elementCount);
+		}
+
+		TEST_METHOD(HashMapTestLoadFactor)
+		{
+			// Test construction with an invalid max load factor
+			Assert::ExpectException<std::exception>([&]
+			{
+				HashMap<std::int32_t, std::int32_t> intKeyHashMap(10, 0.0f);
+			});
+			Assert::ExpectException<std::exception>([&]
+			{
+				HashMap<std::int32_t, std::int32_t> intKeyHashMap(10, 1.5f);
+			});
+
+			// The table should never exceed its max load factor as it grows
+			HashMap<std::int32_t, std::int32_t> intKeyHashMap(4, 0.5f);
+			Assert::AreEqual(0.5f, intKeyHashMap.MaxLoadFactor());
+			Assert::AreEqual(0.0f, intKeyHashMap.LoadFactor());
+			for (std::int32_t i = 0; i < 100; ++i)
+			{
+				intKeyHashMap.Insert(HashMap<std::int32_t, std::int32_t>::PairType(i, i));
+				Assert::IsTrue(intKeyHashMap.LoadFactor() <= 0.5f);
+			}
+
+			// Lowering the max load factor should rehash right away
+			intKeyHashMap.SetMaxLoadFactor(0.25f);
+			Assert::IsTrue(intKeyHashMap.LoadFactor() <= 0.25f);
+			Assert::ExpectException<std::exception>([&] { intKeyHashMap.SetMaxLoadFactor(-1.0f); });
+			for (std::int32_t i = 0; i < 100; ++i)
+			{
+				Assert::AreEqual(i, intKeyHashMap.Find(i)->second);
+			}
+		}
+
+		TEST_METHOD(HashMapTestReserveAndRehash)
+		{
+			HashMap<std::string, std::int32_t> stringKeyHashMap(2);
+			stringKeyHashMap.Reserve(1000);
+			const std::uint32_t reservedCapacity = stringKeyHashMap.Capacity();
+			Assert::IsTrue(reservedCapacity * stringKeyHashMap.MaxLoadFactor() >= 1000.0f);
+
+			// Filling up to the reserved size should not grow the table
+			for (std::int32_t i = 0; i < 1000; ++i)
+			{
+				stringKeyHashMap.Insert(HashMap<std::string, std::int32_t>::PairType(std::to_string(i), i));
+			}
+			Assert::AreEqual(reservedCapacity, stringKeyHashMap.Capacity());
+
+			// Rehashing to a larger size keeps every entry
+			stringKeyHashMap.Rehash(reservedCapacity * 4);
+			Assert::AreEqual(reservedCapacity * 4, stringKeyHashMap.Capacity());
+			Assert::AreEqual(1000U, stringKeyHashMap.Size());
+			Assert::AreEqual(999, stringKeyHashMap["999"]);
+
+			// Rehashing to zero shrinks as far as the entries allow
+			for (std::int32_t i = 0; i < 990; ++i)
+			{
+				stringKeyHashMap.Remove(std::to_string(i));
+			}
+			stringKeyHashMap.Rehash(0);
+			Assert::IsTrue(stringKeyHashMap.Capacity() < reservedCapacity);
+			Assert::IsTrue(stringKeyHashMap.LoadFactor() <= stringKeyHashMap.MaxLoadFactor());
+			Assert::AreEqual(10U, stringKeyHashMap.Size());
+			Assert::AreEqual(995, stringKeyHashMap["995"]);
+		}
+
+		TEST_METHOD(HashMapTestFindWithoutKeyType)
+		{
+			// A std::string keyed table can be searched with a C string
+			HashMap<std::string, std::int32_t> stringKeyHashMap(10);
+			stringKeyHashMap.Insert(HashMap<std::string, std::int32_t>::PairType("sectors", 0));
+			stringKeyHashMap.Insert(HashMap<std::string, std::int32_t>::PairType("entities", 1));
+			const char* entities = "entities";
+			Assert::IsTrue(stringKeyHashMap.Find("sectors") == stringKeyHashMap.Find(std::string("sectors")));
+			Assert::AreEqual(1, stringKeyHashMap.Find(entities)->second);
+			Assert::IsTrue(stringKeyHashMap.Find("actions") == stringKeyHashMap.end());
+
+			// An integer keyed table can be searched with a narrower integer
+			HashMap<std::int64_t, std::int32_t> intKeyHashMap(10);
+			intKeyHashMap.Insert(HashMap<std::int64_t, std::int32_t>::PairType(42, 42));
+			Assert::AreEqual(42, intKeyHashMap.Find(std::int32_t(42))->second);
+		}
+
+		TEST_METHOD(HashMapTestDefaultHash)
+		{
+			// Strings, char* and keys that only differ by a suffix should hash consistently and apart
+			DefaultHash<std::string> stringHash;
+			DefaultHash<char*> charHash;
+			Assert::AreEqual(stringHash("health"), charHash("health"));
+			Assert::AreNotEqual(stringHash("health"), stringHash("health2"));
+			Assert::AreNotEqual(stringHash(""), stringHash(std::string(1, '\0')));
+
+			// Attribute-style names with a long shared prefix should spread over the buckets
+			const std::uint32_t bucketCount = 1024;
+			const std::uint32_t keyCount = 1000;
+			Vector<bool> usedBuckets(bucketCount, true);
+			std::uint32_t distinctBuckets = 0;
+			for (std::uint32_t i = 0; i < keyCount; ++i)
+			{
+				const std::uint32_t bucket = stringHash("sectors.entities.attribute" + std::to_string(i)) % bucketCount;
+				if (!usedBuckets[bucket])
+				{
+					usedBuckets[bucket] = true;
+					++distinctBuckets;
+				}
+			}
+
+			// A uniform hash fills about 64% of the buckets, the old shift-xor hash filled far fewer
+			Assert::IsTrue(distinctBuckets > 550U);
+
+			// Integer keys should spread over the low bits as well
+			DefaultHash<std::int32_t> intHash;
+			Vector<bool> usedIntBuckets(bucketCount, true);
+			distinctBuckets = 0;
+			for (std::int32_t i = 0; i < static_cast<std::int32_t>(keyCount); ++i)
+			{
+				const std::uint32_t bucket = intHash(i * 1024) % bucketCount;
+				if (!usedIntBuckets[bucket])
+				{
+					usedIntBuckets[bucket] = true;
+					++distinctBuckets;
+				}
+			}
+			Assert::IsTrue(distinctBuckets > 550U);
+		}
+
 	private:
 #if defined(DEBUG) | defined(_DEBUG)
 		static _CrtMemState sStartMemState;
@@ -0,0 +1,84 @@
+#include "pch.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace Library;
+
+namespace UnitTestLibraryDesktop
+{
+	TEST_CLASS(JobSystemTest)
+	{
+	public:
+		TEST_METHOD(JobSystemTestParallelFor)
+		{
+			JobSystem jobSystem(4);
+			Assert::AreEqual(4U, jobSystem.WorkerCount());
+
+			// Every index is visited exactly once, whatever thread ends up with its chunk
+			const std::uint32_t count = 10000;
+			std::vector<std::atomic<std::uint32_t>> visits(count);
+			jobSystem.ParallelFor(count, 7, [&visits](std::uint32_t begin, std::uint32_t end)
+			{
+				Assert::IsTrue(end - begin <= 7);
+				for (std::uint32_t i = begin; i < end; ++i)
+				{
+					++visits[i];
+				}
+			});
+
+			for (std::uint32_t i = 0; i < count; ++i)
+			{
+				Assert::AreEqual(1U, visits[i].load());
+			}
+
+			// Small loops run on the calling thread
+			std::thread::id caller;
+			jobSystem.ParallelFor(5, 8, [&caller](std::uint32_t, std::uint32_t) { caller = std::this_thread::get_id(); });
+			Assert::IsTrue(caller == std::this_thread::get_id());
+
+			jobSystem.ParallelFor(0, 8, [](std::uint32_t, std::uint32_t) { Assert::Fail(); });
+			Assert::ExpectException<std::exception>([&jobSystem] { jobSystem.ParallelFor(8, 0, [](std::uint32_t, std::uint32_t) {}); });
+		}
+
+		TEST_METHOD(JobSystemTestNested)
+		{
+			JobSystem jobSystem(2);
+			std::atomic<std::uint32_t> total(0);
+
+			// Threads waiting on an inner loop help run it instead of blocking
+			jobSystem.ParallelFor(8, 1, [&](std::uint32_t begin, std::uint32_t end)
+			{
+				for (std::uint32_t i = begin; i < end; ++i)
+				{
+					jobSystem.ParallelFor(100, 10, [&total](std::uint32_t innerBegin, std::uint32_t innerEnd) { total += innerEnd - innerBegin; });
+				}
+			});
+			Assert::AreEqual(800U, total.load());
+
+			JobSystem serialJobSystem(0);
+			std::uint32_t serialTotal = 0;
+			serialJobSystem.ParallelFor(100, 10, [&serialTotal](std::uint32_t begin, std::uint32_t end) { serialTotal += end - begin; });
+			Assert::AreEqual(100U, serialTotal);
+		}
+
+		TEST_METHOD(JobSystemTestException)
+		{
+			JobSystem jobSystem(3);
+			std::atomic<std::uint32_t> finished(0);
+
+			// The remaining chunks still run before the exception reaches the caller
+			auto expression = [&jobSystem, &finished]
+			{
+				jobSystem.ParallelFor(64, 1, [&finished](std::uint32_t begin, std::uint32_t)
+				{
+					if (begin == 13)
+					{
+						throw std::exception("Chunk failed.");
+					}
+					++finished;
+				});
+			};
+			Assert::ExpectException<std::exception>(expression);
+			Assert::AreEqual(63U, finished.load());
+		}
+	};
+}
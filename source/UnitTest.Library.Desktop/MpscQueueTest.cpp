@@ -0,0 +1,144 @@
+#include "pch.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace Library;
+
+namespace UnitTestLibraryDesktop
+{
+	TEST_CLASS(MpscQueueTest)
+	{
+	public:
+
+#if defined(DEBUG) | defined(_DEBUG)
+		TEST_METHOD_INITIALIZE(Initialize)
+		{
+			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
+			_CrtMemCheckpoint(&sStartMemState);
+		}
+
+		TEST_METHOD_CLEANUP(Cleanup)
+		{
+			_CrtMemState endMemState, diffMemState;
+			_CrtMemCheckpoint(&endMemState);
+			if (_CrtMemDifference(&diffMemState, &sStartMemState, &endMemState))
+			{
+				_CrtMemDumpStatistics(&diffMemState);
+				Assert::Fail(L"Memory Leaks!");
+			}
+		}
+#endif
+
+		TEST_METHOD(MpscQueueTestPushPop)
+		{
+			MpscQueue<Foo> fooQueue;
+			Foo foo;
+			Assert::IsFalse(fooQueue.TryPop(foo));
+
+			// Items come out in the order they went in
+			fooQueue.Push(Foo(0));
+			fooQueue.Push(Foo(1));
+			Assert::IsTrue(fooQueue.TryPop(foo));
+			Assert::IsTrue(Foo(0) == foo);
+			fooQueue.Push(Foo(2));
+			Assert::IsTrue(fooQueue.TryPop(foo));
+			Assert::IsTrue(Foo(1) == foo);
+			Assert::IsTrue(fooQueue.TryPop(foo));
+			Assert::IsTrue(Foo(2) == foo);
+			Assert::IsFalse(fooQueue.TryPop(foo));
+
+			// Items that are never popped are freed with the queue
+			fooQueue.Push(Foo(3));
+			fooQueue.Push(Foo(4));
+		}
+
+		TEST_METHOD(MpscQueueTestRecycling)
+		{
+			// More items than the queue keeps free nodes for, so pushes both reuse nodes and allocate new ones
+			MpscQueue<std::uint32_t> queue;
+			const std::uint32_t itemCount = 1000;
+			for (std::uint32_t round = 0; round < 3; ++round)
+			{
+				for (std::uint32_t i = 0; i < itemCount; ++i)
+				{
+					queue.Push(round * itemCount + i);
+				}
+
+				for (std::uint32_t i = 0; i < itemCount; ++i)
+				{
+					std::uint32_t item;
+					Assert::IsTrue(queue.TryPop(item));
+					Assert::AreEqual(round * itemCount + i, item);
+				}
+			}
+
+			// Interleaved pushes and pops keep handing the same few nodes around
+			for (std::uint32_t i = 0; i < itemCount; ++i)
+			{
+				std::uint32_t item;
+				queue.Push(i);
+				queue.Push(i + 1);
+				Assert::IsTrue(queue.TryPop(item));
+				Assert::AreEqual(i, item);
+				Assert::IsTrue(queue.TryPop(item));
+				Assert::AreEqual(i + 1, item);
+			}
+
+			std::uint32_t item;
+			Assert::IsFalse(queue.TryPop(item));
+			queue.Push(1);
+		}
+
+		TEST_METHOD(MpscQueueTestProducers)
+		{
+			MpscQueue<std::uint32_t> queue;
+			const std::uint32_t producerCount = 4;
+			const std::uint32_t itemCount = 20000;
+
+			std::vector<std::thread> producers;
+			for (std::uint32_t producer = 0; producer < producerCount; ++producer)
+			{
+				producers.emplace_back([&queue, producer, itemCount]
+				{
+					for (std::uint32_t i = 0; i < itemCount; ++i)
+					{
+						queue.Push(producer * itemCount + i);
+					}
+				});
+			}
+
+			// The consumer pops while the producers push, and sees each producer's items in order
+			std::uint32_t nextItems[producerCount] = {};
+			std::uint32_t popped = 0;
+			while (popped < producerCount * itemCount)
+			{
+				std::uint32_t item;
+				if (queue.TryPop(item))
+				{
+					const std::uint32_t producer = item / itemCount;
+					Assert::AreEqual(nextItems[producer], item % itemCount);
+					++nextItems[producer];
+					++popped;
+				}
+			}
+
+			for (std::thread& producer : producers)
+			{
+				producer.join();
+			}
+
+			std::uint32_t item;
+			Assert::IsFalse(queue.TryPop(item));
+		}
+
+		private:
+#if defined(DEBUG) | defined(_DEBUG)
+			static _CrtMemState sStartMemState;
+#endif
+
+	};
+
+#if defined(DEBUG) | defined(_DEBUG)
+	_CrtMemState MpscQueueTest::sStartMemState;
+#endif
+
+}
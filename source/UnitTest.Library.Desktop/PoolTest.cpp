@@ -0,0 +1,140 @@
+#include "pch.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace Library;
+
+namespace UnitTestLibraryDesktop
+{
+	TEST_CLASS(PoolTest)
+	{
+	public:
+
+#if defined(DEBUG) | defined(_DEBUG)
+		TEST_METHOD_INITIALIZE(Initialize)
+		{
+			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
+			_CrtMemCheckpoint(&sStartMemState);
+		}
+
+		TEST_METHOD_CLEANUP(Cleanup)
+		{
+			_CrtMemState endMemState, diffMemState;
+			_CrtMemCheckpoint(&endMemState);
+			if (_CrtMemDifference(&diffMemState, &sStartMemState, &endMemState))
+			{
+				_CrtMemDumpStatistics(&diffMemState);
+				Assert::Fail(L"Memory Leaks!");
+			}
+		}
+#endif
+
+		TEST_METHOD(PoolTestConstructor)
+		{
+			Pool pool(sizeof(std::int32_t));
+			Assert::AreEqual(0U, pool.BlockCount());
+			Assert::IsTrue(pool.ChunkSize() >= sizeof(void*));
+			Assert::AreEqual(static_cast<std::size_t>(0), pool.ChunkSize() % alignof(std::max_align_t));
+
+			auto expression = [] { Pool badPool(sizeof(std::int32_t), 0); };
+			Assert::ExpectException<std::exception>(expression);
+		}
+
+		TEST_METHOD(PoolTestAllocate)
+		{
+			Pool pool(sizeof(glm::mat4), 4);
+
+			void* chunks[5];
+			for (std::uint32_t i = 0; i < 4; ++i)
+			{
+				chunks[i] = pool.Allocate();
+				Assert::IsNotNull(chunks[i]);
+			}
+			Assert::AreEqual(1U, pool.BlockCount());
+
+			// The fifth chunk no longer fits in the first block
+			chunks[4] = pool.Allocate();
+			Assert::AreEqual(2U, pool.BlockCount());
+
+			for (std::uint32_t i = 0; i < 5; ++i)
+			{
+				for (std::uint32_t j = i + 1; j < 5; ++j)
+				{
+					Assert::IsTrue(chunks[i] != chunks[j]);
+				}
+			}
+		}
+
+		TEST_METHOD(PoolTestDeallocate)
+		{
+			Pool pool(sizeof(std::string), 2);
+			void* first = pool.Allocate();
+			void* second = pool.Allocate();
+
+			// Freed chunks are handed out again, most recently freed first
+			pool.Deallocate(first);
+			pool.Deallocate(second);
+			Assert::IsTrue(second == pool.Allocate());
+			Assert::IsTrue(first == pool.Allocate());
+			Assert::AreEqual(1U, pool.BlockCount());
+
+			pool.Deallocate(nullptr);
+			pool.Allocate();
+			Assert::AreEqual(2U, pool.BlockCount());
+		}
+
+		TEST_METHOD(PoolTestMoveSemantics)
+		{
+			Pool pool(sizeof(std::int32_t), 2);
+			void* chunk = pool.Allocate();
+			pool.Deallocate(chunk);
+
+			Pool movedPool(std::move(pool));
+			Assert::AreEqual(0U, pool.BlockCount());
+			Assert::AreEqual(1U, movedPool.BlockCount());
+			Assert::IsTrue(chunk == movedPool.Allocate());
+
+			Pool assignedPool(sizeof(std::int32_t));
+			assignedPool.Allocate();
+			assignedPool = std::move(movedPool);
+			Assert::AreEqual(0U, movedPool.BlockCount());
+			Assert::AreEqual(1U, assignedPool.BlockCount());
+
+			// A moved-from Pool can still hand out chunks
+			Assert::IsNotNull(pool.Allocate());
+			Assert::AreEqual(1U, pool.BlockCount());
+		}
+
+		TEST_METHOD(PoolTestSListNodes)
+		{
+			SList<std::int32_t> list;
+			for (std::int32_t i = 0; i < 100; ++i)
+			{
+				list.PushBack(i);
+			}
+			Assert::AreEqual(100U, list.Size());
+
+			// Removing and re-adding nodes recycles their memory
+			for (std::int32_t i = 0; i < 50; ++i)
+			{
+				list.PopFront();
+			}
+			for (std::int32_t i = 0; i < 50; ++i)
+			{
+				list.PushFront(i);
+			}
+			Assert::AreEqual(100U, list.Size());
+			Assert::AreEqual(49, list.Front());
+			Assert::AreEqual(99, list.Back());
+		}
+
+	private:
+#if defined(DEBUG) | defined(_DEBUG)
+		static _CrtMemState sStartMemState;
+#endif
+	};
+
+#if defined(DEBUG) | defined(_DEBUG)
+	_CrtMemState PoolTest::sStartMemState;
+#endif
+
+}
@@ -0,0 +1,146 @@
+#include "pch.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace Library;
+
+namespace UnitTestLibraryDesktop
+{
+	struct FooLess
+	{
+		bool operator()(const Foo& lhs, const Foo& rhs) const { return lhs.Data() < rhs.Data(); }
+	};
+
+	TEST_CLASS(PriorityQueueTest)
+	{
+	public:
+
+#if defined(DEBUG) | defined(_DEBUG)
+		TEST_METHOD_INITIALIZE(Initialize)
+		{
+			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
+			_CrtMemCheckpoint(&sStartMemState);
+		}
+
+		TEST_METHOD_CLEANUP(Cleanup)
+		{
+			_CrtMemState endMemState, diffMemState;
+			_CrtMemCheckpoint(&endMemState);
+			if (_CrtMemDifference(&diffMemState, &sStartMemState, &endMemState))
+			{
+				_CrtMemDumpStatistics(&diffMemState);
+				Assert::Fail(L"Memory Leaks!");
+			}
+		}
+#endif
+
+		TEST_METHOD(PriorityQueueTestConstructor)
+		{
+			PriorityQueue<std::int32_t> intQueue;
+			Assert::AreEqual(0U, intQueue.Size());
+			Assert::IsTrue(intQueue.IsEmpty());
+			Assert::ExpectException<std::exception>([&] { intQueue.Top(); });
+			Assert::ExpectException<std::exception>([&] { intQueue.Pop(); });
+
+			PriorityQueue<Foo, FooLess> fooQueue;
+			Assert::AreEqual(0U, fooQueue.Size());
+			Assert::ExpectException<std::exception>([&] { fooQueue.Top(); });
+		}
+
+		TEST_METHOD(PriorityQueueTestPushPop)
+		{
+			// Items come out smallest first, whatever order they went in
+			PriorityQueue<std::int32_t> intQueue;
+			const std::int32_t intData[] = { 5, 3, 8, 1, 9, 1, 7, 2, 6, 4, 0 };
+			for (std::int32_t item : intData)
+			{
+				intQueue.Push(item);
+			}
+			Assert::AreEqual(11U, intQueue.Size());
+			Assert::AreEqual(0, intQueue.Top());
+
+			std::int32_t previous = -1;
+			while (!intQueue.IsEmpty())
+			{
+				Assert::AreEqual(intQueue.Top(), intQueue.Top());
+				const std::int32_t item = intQueue.Pop();
+				Assert::IsTrue(previous <= item);
+				previous = item;
+			}
+			Assert::AreEqual(9, previous);
+
+			// A larger comparison turns it into a max-heap
+			PriorityQueue<std::int32_t, std::greater<std::int32_t>> maxQueue;
+			for (std::int32_t i = 0; i < 100; ++i)
+			{
+				maxQueue.Push((i * 37) % 100);
+			}
+			for (std::int32_t i = 99; i >= 0; --i)
+			{
+				Assert::AreEqual(i, maxQueue.Pop());
+			}
+
+			// Test a user-defined data type
+			PriorityQueue<Foo, FooLess> fooQueue;
+			fooQueue.Push(Foo(2));
+			fooQueue.Push(Foo(0));
+			fooQueue.Push(Foo(1));
+			Assert::IsTrue(Foo(0) == fooQueue.Pop());
+			Assert::IsTrue(Foo(1) == fooQueue.Pop());
+			fooQueue.Push(Foo(-1));
+			Assert::IsTrue(Foo(-1) == fooQueue.Top());
+			Assert::AreEqual(2U, fooQueue.Size());
+		}
+
+		TEST_METHOD(PriorityQueueTestCopyMove)
+		{
+			PriorityQueue<Foo, FooLess> existingQueue;
+			for (std::int32_t i = 10; i > 0; --i)
+			{
+				existingQueue.Push(Foo(i));
+			}
+
+			PriorityQueue<Foo, FooLess> copiedQueue = existingQueue;
+			Assert::AreEqual(existingQueue.Size(), copiedQueue.Size());
+			while (!copiedQueue.IsEmpty())
+			{
+				Assert::IsTrue(existingQueue.Pop() == copiedQueue.Pop());
+			}
+
+			existingQueue.Push(Foo(3));
+			existingQueue.Push(Foo(2));
+			PriorityQueue<Foo, FooLess> movedQueue = std::move(existingQueue);
+			Assert::AreEqual(2U, movedQueue.Size());
+			Assert::IsTrue(existingQueue.IsEmpty());
+
+			copiedQueue = std::move(movedQueue);
+			Assert::IsTrue(movedQueue.IsEmpty());
+			Assert::IsTrue(Foo(2) == copiedQueue.Pop());
+			Assert::IsTrue(Foo(3) == copiedQueue.Pop());
+		}
+
+		TEST_METHOD(PriorityQueueTestClear)
+		{
+			PriorityQueue<std::int32_t> intQueue;
+			intQueue.Clear();
+			Assert::AreEqual(0U, intQueue.Size());
+			intQueue.Push(2);
+			intQueue.Push(1);
+			intQueue.Clear();
+			Assert::AreEqual(0U, intQueue.Size());
+			Assert::ExpectException<std::exception>([&] { intQueue.Top(); });
+			intQueue.Push(3);
+			Assert::AreEqual(3, intQueue.Top());
+		}
+
+		private:
+#if defined(DEBUG) | defined(_DEBUG)
+			static _CrtMemState sStartMemState;
+#endif
+
+	};
+
+#if defined(DEBUG) | defined(_DEBUG)
+	_CrtMemState PriorityQueueTest::sStartMemState;
+#endif
+
+}
@@ -65,6 +65,152 @@ namespace UnitTestLibraryDesktop
 			actionEvent.Update(state);
 		}
 
+		TEST_METHOD(ReactionTestSubtypeDispatch)
+		{
+			World world("World");
+			Library::WorldState state;
+			state.world = &world;
+			world.SetWorldState(state);
+			JobSystem jobSystem(0);
+
+			ReactionAttributed first("First");
+			ReactionAttributed second("Second");
+			FooAction& firstAction = *new FooAction("FirstAction");
+			FooAction& secondAction = *new FooAction("SecondAction");
+			first.Adopt(firstAction, "actions");
+			second.Adopt(secondAction, "actions");
+			first.SetSubtype("jump");
+			second.SetSubtype("run");
+			Assert::AreEqual(1U, ReactionAttributed::ReactionCount("jump"));
+			Assert::AreEqual(1U, ReactionAttributed::ReactionCount("run"));
+
+			// Only the reactions filed under the event's subtype are notified
+			Event<EventMessageAttributed> jumpEvent(EventMessageAttributed("jump", &world));
+			jumpEvent.Deliver(jobSystem);
+			Assert::AreEqual(1U, firstAction.UpdateCount());
+			Assert::AreEqual(0U, secondAction.UpdateCount());
+
+			Event<EventMessageAttributed> walkEvent(EventMessageAttributed("walk", &world));
+			walkEvent.Deliver(jobSystem);
+			Assert::AreEqual(1U, firstAction.UpdateCount());
+			Assert::AreEqual(0U, secondAction.UpdateCount());
+
+			// A subtype written through the attribute, as the XML parser does, takes effect once the Reaction is refiled
+			second.Find("subtype")->Set(std::string("jump"));
+			Assert::IsTrue(second.GetSubtype() == "jump");
+			Assert::AreEqual(1U, ReactionAttributed::ReactionCount("run"));
+			second.Refile();
+			jumpEvent.Deliver(jobSystem);
+			Assert::AreEqual(2U, firstAction.UpdateCount());
+			Assert::AreEqual(1U, secondAction.UpdateCount());
+			Assert::AreEqual(0U, ReactionAttributed::ReactionCount("run"));
+			Assert::AreEqual(2U, ReactionAttributed::ReactionCount("jump"));
+
+			// Refiling a Reaction whose subtype has not changed leaves it where it is
+			first.Refile();
+			Assert::AreEqual(2U, ReactionAttributed::ReactionCount("jump"));
+
+			// Delivered in a batch, each event still reaches its subtype
+			second.SetSubtype("walk");
+			EventQueue queue(jobSystem);
+			queue.SetBatchDelivery(true);
+			GameTime gameTime;
+			const auto start = std::chrono::high_resolution_clock::now();
+			gameTime.SetCurrentTime(start);
+			queue.Enqueue(jumpEvent, gameTime, Milliseconds(10));
+			queue.Enqueue(walkEvent, gameTime, Milliseconds(10));
+			gameTime.SetCurrentTime(start + Milliseconds(20));
+			queue.Update(gameTime);
+			Assert::IsTrue(queue.IsEmpty());
+			Assert::AreEqual(3U, firstAction.UpdateCount());
+			Assert::AreEqual(2U, secondAction.UpdateCount());
+
+			{
+				ReactionAttributed third("Third");
+				third.SetSubtype("jump");
+				Assert::AreEqual(2U, ReactionAttributed::ReactionCount("jump"));
+			}
+			Assert::AreEqual(1U, ReactionAttributed::ReactionCount("jump"));
+			Assert::AreEqual(1U, ReactionAttributed::ReactionCount("walk"));
+		}
+
+		TEST_METHOD(ReactionTestActionEventPool)
+		{
+			World world("World");
+			GameTime gameTime;
+			const auto start = std::chrono::high_resolution_clock::now();
+			gameTime.SetCurrentTime(start);
+			Library::WorldState state(gameTime);
+			state.world = &world;
+			world.SetWorldState(state);
+
+			ActionEvent actionEvent;
+			actionEvent.Find("subtype")->Set(std::string("jump"));
+			actionEvent.Find("delay")->Set(10);
+
+			// Firing once a frame only ever needs as many events as are in flight at once
+			for (std::uint32_t frame = 0; frame < 10; ++frame)
+			{
+				actionEvent.Update(state);
+				actionEvent.Update(state);
+				Assert::AreEqual(2U, world.EventQueue().Size());
+				Assert::AreEqual(0U, world.EventPool().AvailableCount());
+
+				gameTime.SetCurrentTime(gameTime.CurrentTime() + Milliseconds(20));
+				world.EventQueue().Update(gameTime);
+				Assert::IsTrue(world.EventQueue().IsEmpty());
+				Assert::AreEqual(2U, world.EventPool().Size());
+				Assert::AreEqual(2U, world.EventPool().AvailableCount());
+			}
+
+			// Events still queued when the World goes away are returned to its pool first
+			actionEvent.Update(state);
+			Assert::AreEqual(1U, world.EventPool().AvailableCount());
+		}
+
+		TEST_METHOD(ReactionTestAuxiliaryParameters)
+		{
+			World world("World");
+			GameTime gameTime;
+			const auto start = std::chrono::high_resolution_clock::now();
+			gameTime.SetCurrentTime(start);
+			Library::WorldState state(gameTime);
+			state.world = &world;
+			world.SetWorldState(state);
+
+			ReactionAttributed reaction("Reaction");
+			reaction.SetSubtype("jump");
+
+			ActionEvent actionEvent;
+			actionEvent.Find("subtype")->Set(std::string("jump"));
+			actionEvent.Find("delay")->Set(10);
+			actionEvent.AppendAuxiliaryAttribute("power") = 5;
+			actionEvent.AppendAuxiliaryAttribute("direction") = std::string("up");
+
+			// The reaction receives the parameters of the action that fired the event
+			actionEvent.Update(state);
+			gameTime.SetCurrentTime(gameTime.CurrentTime() + Milliseconds(20));
+			world.EventQueue().Update(gameTime);
+			Assert::IsNotNull(reaction.Find("power"));
+			Assert::IsTrue(*reaction.Find("power") == 5);
+			Assert::IsNotNull(reaction.Find("direction"));
+			Assert::IsTrue(*reaction.Find("direction") == std::string("up"));
+
+			// The pooled event does not carry them over into the next firing
+			ReactionAttributed laterReaction("LaterReaction");
+			laterReaction.SetSubtype("jump");
+			ActionEvent plainEvent;
+			plainEvent.Find("subtype")->Set(std::string("jump"));
+			plainEvent.Find("delay")->Set(10);
+			plainEvent.Update(state);
+			Assert::AreEqual(1U, world.EventPool().Size());
+			gameTime.SetCurrentTime(gameTime.CurrentTime() + Milliseconds(20));
+			world.EventQueue().Update(gameTime);
+			Assert::IsNull(laterReaction.Find("power"));
+			Assert::IsNull(laterReaction.Find("direction"));
+			Assert::IsTrue(*reaction.Find("power") == 5);
+		}
+
 	private:
 #if defined(DEBUG) | defined(_DEBUG)
 		static _CrtMemState sStartMemState;
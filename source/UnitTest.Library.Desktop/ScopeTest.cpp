@@ -10,6 +10,15 @@ namespace UnitTestLibraryDesktop
 	public:
 
 #if defined(DEBUG) | defined(_DEBUG)
+		TEST_CLASS_INITIALIZE(InitializeClass)
+		{
+			// Names stay interned for good, so intern the ones these tests append before the first leak checkpoint
+			for (const char* name : { "first", "second", "secondChild", "child", "grandchild", "value", "a", "b", "nested", "test", "apple", "banana", "cat", "dog", "ChildScope", "IntegerData", "NestedScope", "NestedeScope", "EmptyNestedScope", "NewScope", "MyScope", "Integer", "Float", "Test", "Children", "Grandchildren", "Other", "Child", "Grandchild", "Name", "Values", "one", "two", "three", "new" })
+			{
+				Symbol symbol(name);
+			}
+		}
+
 		TEST_METHOD_INITIALIZE(Initialize)
 		{
 			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
@@ -62,6 +71,58 @@ namespace UnitTestLibraryDesktop
 			Assert::IsTrue(existingScope.GetParent() == newScope.GetParent());
 		}
 
+		TEST_METHOD(ScopeTestMoveSemantics)
+		{
+			Scope parent;
+			Scope& child = parent.AppendScope("child");
+			child.Append("value") = 5;
+			Scope& grandchild = child.AppendScope("grandchild");
+			Datum* value = child.Find("value");
+
+			// Moving into a stack scope leaves the parent alone: the moved-from scope is orphaned, not replaced
+			{
+				Scope moved(std::move(child));
+				Assert::IsNull(moved.GetParent());
+				Assert::IsTrue(grandchild.GetParent() == &moved);
+				Assert::IsTrue(moved.Find("value") == value);
+				Assert::AreEqual(0U, child.Size());
+				Assert::IsNull(child.GetParent());
+				Assert::AreEqual(0U, parent.Find("child")->Size());
+				delete &child;
+			}
+			Assert::AreEqual(1U, parent.Size());
+
+			// Moving between two parented scopes keeps the target in its own slot
+			Scope& first = parent.AppendScope("first");
+			Scope& second = parent.AppendScope("second");
+			second.Append("value") = 7;
+			Scope& secondChild = second.AppendScope("secondChild");
+			first = std::move(second);
+			Assert::IsTrue(first.GetParent() == &parent);
+			Assert::IsTrue(parent.Find("first")->Get<Scope*>(0) == &first);
+			Assert::AreEqual(0U, parent.Find("second")->Size());
+			Assert::IsNull(second.GetParent());
+			Assert::IsTrue(secondChild.GetParent() == &first);
+			Assert::IsTrue(first.Find("value")->Get<std::int32_t>(0) == 7);
+			delete &second;
+
+			// The target is still an ordinary child afterwards
+			first.Orphan();
+			Assert::AreEqual(0U, parent.Find("first")->Size());
+			delete &first;
+
+			Scope source;
+			source.Append("a") = 1;
+			Scope& nested = source.AppendScope("nested");
+			Scope target;
+			target.Append("b") = 2;
+			target = std::move(source);
+			Assert::IsNotNull(target.Find("a"));
+			Assert::IsNull(target.Find("b"));
+			Assert::IsTrue(nested.GetParent() == &target);
+			Assert::AreEqual(0U, source.Size());
+		}
+
 		TEST_METHOD(ScopeTestSubscriptOperator)
 		{
 			Scope scope;
@@ -160,6 +221,46 @@ namespace UnitTestLibraryDesktop
 			Assert::IsNull(childScope.GetParent());
 		}
 
+		TEST_METHOD(ScopeTestOrphanManySiblings)
+		{
+			Scope parentScope;
+			Scope* children[5];
+			for (std::uint32_t i = 0; i < 5; ++i)
+			{
+				children[i] = &parentScope.AppendScope("Children");
+			}
+			Datum& datum = *parentScope.Find("Children");
+
+			// The last sibling fills the hole and still knows where it lives
+			children[1]->Orphan();
+			Assert::AreEqual(4U, datum.Size());
+			Assert::IsTrue(datum.Get<Scope*>(1) == children[4]);
+			Assert::IsNull(children[1]->GetParent());
+
+			children[4]->Orphan();
+			Assert::AreEqual(3U, datum.Size());
+			Assert::IsTrue(datum.Get<Scope*>(1) == children[3]);
+			Assert::IsTrue(parentScope.FindContainedScope(*children[4]) == nullptr);
+
+			// A slot made stale by editing the table directly falls back to a search
+			datum.RemoveTable(0);
+			children[0]->Orphan();
+			children[3]->Orphan();
+			Assert::AreEqual(1U, datum.Size());
+			Assert::IsTrue(datum.Get<Scope*>(0) == children[2]);
+
+			// Adopting into another table moves the scope out of its old slot
+			parentScope.Adopt(*children[1], "Children");
+			parentScope.Adopt(*children[2], "Other");
+			Assert::AreEqual(1U, datum.Size());
+			Assert::IsTrue(datum.Get<Scope*>(0) == children[1]);
+			Assert::IsTrue(parentScope.FindContainedScope(*children[2]) == parentScope.Find("Other"));
+
+			delete children[0];
+			delete children[3];
+			delete children[4];
+		}
+
 		TEST_METHOD(ScopeTestFind)
 		{
 			Scope scope;
@@ -171,6 +272,12 @@ namespace UnitTestLibraryDesktop
 			Assert::IsNotNull(foundScope);
 			Datum& foundDatum = *foundScope;
 			Assert::IsTrue(foundDatum == datum);
+
+			// Lookups by std::string and by C string should agree
+			Assert::IsTrue(scope.Find(std::string("Test")) == foundScope);
+			const char* nullName = nullptr;
+			Assert::IsNull(scope.Find(nullName));
+			Assert::IsNull(scope.Find(std::string()));
 		}
 
 		TEST_METHOD(ScopeTestSearch)
@@ -291,6 +398,77 @@ namespace UnitTestLibraryDesktop
 			Assert::ExpectException<std::exception>([&] {invalidParent.FindName(emptyNestedScope); });
 		}
 
+		TEST_METHOD(ScopeTestAllocatorGuard)
+		{
+			SystemAllocator allocator;
+			{
+				Scope scope;
+				Assert::IsTrue(&scope.GetAllocator() == &Allocator::Default());
+
+				Scope* child = nullptr;
+				{
+					Scope::AllocatorGuard guard(allocator);
+					child = new Scope();
+					Assert::IsTrue(&child->GetAllocator() == &allocator);
+
+					Scope::AllocatorGuard innerGuard(Allocator::Default());
+					Scope* heapScope = new Scope();
+					Assert::IsTrue(&heapScope->GetAllocator() == &Allocator::Default());
+					delete heapScope;
+				}
+				Assert::IsTrue(&Scope().GetAllocator() == &Allocator::Default());
+
+				// Children of a scope come from the same Allocator, as do the values of its entries
+				Scope& grandchild = child->AppendScope("Grandchild");
+				Assert::IsTrue(&grandchild.GetAllocator() == &allocator);
+				grandchild.Append("Name") = "Grandchild";
+#if defined(DEBUG) | defined(_DEBUG)
+				const std::size_t bytesInUse = allocator.BytesInUse();
+#endif
+				Datum& values = grandchild.Append("Values");
+				values.SetType(Datum::DatumType::Matrix);
+				values.PushBack(glm::mat4());
+#if defined(DEBUG) | defined(_DEBUG)
+				Assert::IsTrue(allocator.BytesInUse() > bytesInUse);
+#endif
+
+				scope.Adopt(*child, "Child");
+			}
+#if defined(DEBUG) | defined(_DEBUG)
+			Assert::AreEqual(static_cast<std::size_t>(0), allocator.BytesInUse());
+#endif
+		}
+
+		TEST_METHOD(ScopeTestPlacementNew)
+		{
+			// Containers construct their elements in place, which needs the placement form of new
+			{
+				Vector<Scope> scopes;
+				scopes.PushBack(Scope());
+				scopes[0].Append("value") = 5;
+				Assert::AreEqual(1U, scopes.Size());
+				Assert::IsTrue(scopes[0].Find("value")->Get<std::int32_t>(0) == 5);
+			}
+
+			Scope* scope = new (std::nothrow) Scope();
+			Assert::IsNotNull(scope);
+			Assert::IsTrue(&scope->GetAllocator() == &Allocator::Default());
+			delete scope;
+		}
+
+		TEST_METHOD(ScopeTestClearManyChildren)
+		{
+			Scope scope;
+			for (std::uint32_t i = 0; i < 1000; ++i)
+			{
+				scope.AppendScope("Children").AppendScope("Grandchildren");
+			}
+			Assert::AreEqual(1000U, scope["Children"].Size());
+
+			scope.Clear();
+			Assert::AreEqual(0U, scope.Size());
+		}
+
 		TEST_METHOD(ScopeTestSize)
 		{
 			Scope scopeWithCapacity(5);
@@ -0,0 +1,220 @@
+#include "pch.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace Library;
+
+namespace UnitTestLibraryDesktop
+{
+	TEST_CLASS(SymbolTest)
+	{
+	public:
+
+#if defined(DEBUG) | defined(_DEBUG)
+		TEST_CLASS_INITIALIZE(InitializeClass)
+		{
+			// Interned names are never released, so intern the ones these tests use before any leak checkpoint
+			for (const char* name : { "health", "child" })
+			{
+				Symbol symbol(name);
+			}
+
+			for (std::uint32_t i = 0; i < 10; ++i)
+			{
+				Symbol symbol("shared" + std::to_string(i));
+			}
+		}
+
+		TEST_METHOD_INITIALIZE(Initialize)
+		{
+			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
+			_CrtMemCheckpoint(&sStartMemState);
+		}
+
+		TEST_METHOD_CLEANUP(Cleanup)
+		{
+			_CrtMemState endMemState, diffMemState;
+			_CrtMemCheckpoint(&endMemState);
+			if (_CrtMemDifference(&diffMemState, &sStartMemState, &endMemState))
+			{
+				_CrtMemDumpStatistics(&diffMemState);
+				Assert::Fail(L"Memory Leaks!");
+			}
+		}
+#endif
+
+		TEST_METHOD(SymbolTestConstructor)
+		{
+			Symbol emptySymbol;
+			Assert::IsTrue(emptySymbol.IsEmpty());
+			Assert::AreEqual(0U, emptySymbol.Id());
+			Assert::IsTrue(emptySymbol.Name().empty());
+			Assert::IsTrue(Symbol("").IsEmpty());
+			Assert::IsTrue(Symbol(static_cast<const char*>(nullptr)).IsEmpty());
+
+			Symbol symbol("health");
+			Assert::IsFalse(symbol.IsEmpty());
+			Assert::IsTrue(symbol.Name() == "health");
+			Assert::AreNotEqual(0U, symbol.Id());
+		}
+
+		TEST_METHOD(SymbolTestInterning)
+		{
+			const std::uint32_t count = Symbol::Count();
+			{
+				Symbol first("symbolTestPosition");
+				Symbol second(std::string("symbolTestPosition"));
+				Symbol third("symbolTestVelocity");
+				Assert::IsTrue(first == second);
+				Assert::IsTrue(first != third);
+				Assert::AreEqual(first.Id(), second.Id());
+				Assert::IsTrue(&first.Name() == &second.Name());
+				Assert::AreEqual(count + 2, Symbol::Count());
+
+				// Copies and moves share the same entry, and moving leaves the source as it was
+				Symbol copy(first);
+				Symbol moved(std::move(copy));
+				Assert::IsTrue(copy == first);
+				Assert::IsTrue(moved == first);
+				copy = third;
+				Assert::IsTrue(copy == third);
+				copy = std::move(moved);
+				Assert::IsTrue(copy == first);
+			}
+
+			// Names stay interned after the last Symbol that refers to them is gone
+			Assert::AreEqual(count + 2, Symbol::Count());
+			Assert::IsFalse(Symbol::Find("symbolTestPosition").IsEmpty());
+			Assert::IsTrue(Symbol::Find("symbolTestPosition").Name() == "symbolTestPosition");
+
+#if defined(DEBUG) | defined(_DEBUG)
+			// The two names interned here are kept for good, so the leak check starts over from here
+			_CrtMemCheckpoint(&sStartMemState);
+#endif
+		}
+
+		TEST_METHOD(SymbolTestFind)
+		{
+			Assert::IsTrue(Symbol::Find("never interned").IsEmpty());
+			Assert::IsTrue(Symbol::Find(static_cast<const char*>(nullptr)).IsEmpty());
+
+			Symbol symbol("entities");
+			Assert::IsTrue(Symbol::Find("entities") == symbol);
+			Assert::IsTrue(Symbol::Find(std::string("entities")) == symbol);
+		}
+
+		TEST_METHOD(SymbolTestScope)
+		{
+			Scope scope;
+			Symbol name("sectors");
+			Datum& datum = scope.Append(name);
+			datum = 10;
+
+			Assert::IsTrue(scope.Find(name) == &datum);
+			Assert::IsTrue(scope.Find("sectors") == &datum);
+			Assert::IsTrue(scope.Find(std::string("sectors")) == &datum);
+			Assert::IsTrue(&scope.Append("sectors") == &datum);
+			Assert::IsNull(scope.Find(Symbol()));
+			Assert::ExpectException<std::exception>([&] { scope.Append(Symbol()); });
+
+			Scope& child = scope.AppendScope(Symbol("child"));
+			Scope* foundScope = nullptr;
+			Assert::IsTrue(child.Search(name, &foundScope) == &datum);
+			Assert::IsTrue(foundScope == &scope);
+			Assert::IsTrue(scope.FindName(child) == "child");
+		}
+
+		TEST_METHOD(SymbolTestThreads)
+		{
+			{
+				std::vector<std::future<void>> futures;
+				std::vector<Symbol> symbols(8);
+				for (std::uint32_t i = 0; i < 8; ++i)
+				{
+					futures.emplace_back(std::async(std::launch::async, [&symbols, i]
+					{
+						for (std::uint32_t j = 0; j < 1000; ++j)
+						{
+							Symbol symbol("shared" + std::to_string(j % 10));
+							Symbol copy(symbol);
+						}
+						symbols[i] = Symbol("shared0");
+					}));
+				}
+
+				for (auto& f : futures)
+				{
+					f.get();
+				}
+
+				for (std::uint32_t i = 1; i < 8; ++i)
+				{
+					Assert::IsTrue(symbols[i] == symbols[0]);
+				}
+			}
+
+			for (std::uint32_t j = 0; j < 10; ++j)
+			{
+				Assert::IsFalse(Symbol::Find("shared" + std::to_string(j)).IsEmpty());
+			}
+		}
+
+		TEST_METHOD(SymbolTestGrowth)
+		{
+			{
+				// Enough new names to grow the table while other threads keep looking names up
+				const std::uint32_t NameCount = 4000;
+				Symbol known("symbolTestKnown");
+				const std::uint32_t count = Symbol::Count();
+				std::atomic<bool> done(false);
+				std::vector<std::future<bool>> readers;
+				for (std::uint32_t i = 0; i < 4; ++i)
+				{
+					readers.emplace_back(std::async(std::launch::async, [&done, &known]
+					{
+						bool allFound = true;
+						while (!done)
+						{
+							allFound &= (Symbol::Find("symbolTestKnown") == known);
+						}
+						return allFound;
+					}));
+				}
+
+				std::vector<Symbol> symbols;
+				for (std::uint32_t i = 0; i < NameCount; ++i)
+				{
+					symbols.push_back(Symbol("symbolTestGrowth" + std::to_string(i)));
+				}
+				done = true;
+
+				for (auto& f : readers)
+				{
+					Assert::IsTrue(f.get());
+				}
+
+				Assert::AreEqual(count + NameCount, Symbol::Count());
+				for (std::uint32_t i = 0; i < NameCount; ++i)
+				{
+					Assert::IsTrue(Symbol::Find("symbolTestGrowth" + std::to_string(i)) == symbols[i]);
+					Assert::AreEqual(symbols[0].Id() + i, symbols[i].Id());
+				}
+			}
+
+#if defined(DEBUG) | defined(_DEBUG)
+			// The grown table and the names interned here are kept for good, so the leak check starts over from here
+			_CrtMemCheckpoint(&sStartMemState);
+#endif
+		}
+
+	private:
+#if defined(DEBUG) | defined(_DEBUG)
+		static _CrtMemState sStartMemState;
+#endif
+
+	};
+
+#if defined(DEBUG) | defined(_DEBUG)
+	_CrtMemState SymbolTest::sStartMemState;
+#endif
+
+}
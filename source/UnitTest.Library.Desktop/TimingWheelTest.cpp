@@ -0,0 +1,162 @@
+#include "pch.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace Library;
+using namespace std::chrono;
+
+namespace UnitTestLibraryDesktop
+{
+	TEST_CLASS(TimingWheelTest)
+	{
+	public:
+
+#if defined(DEBUG) | defined(_DEBUG)
+		TEST_METHOD_INITIALIZE(Initialize)
+		{
+			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
+			_CrtMemCheckpoint(&sStartMemState);
+		}
+
+		TEST_METHOD_CLEANUP(Cleanup)
+		{
+			_CrtMemState endMemState, diffMemState;
+			_CrtMemCheckpoint(&endMemState);
+			if (_CrtMemDifference(&diffMemState, &sStartMemState, &endMemState))
+			{
+				_CrtMemDumpStatistics(&diffMemState);
+				Assert::Fail(L"Memory Leaks!");
+			}
+		}
+#endif
+
+		TEST_METHOD(TimingWheelTestAdvance)
+		{
+			typedef TimingWheel<std::uint32_t>::TimePoint TimePoint;
+			const TimePoint start = high_resolution_clock::now();
+			TimingWheel<std::uint32_t> wheel;
+			Assert::IsTrue(wheel.IsEmpty());
+			Assert::IsTrue(wheel.NextExpiryTime() == TimePoint::max());
+
+			// Delays that land on every level and on the overflow list
+			const milliseconds delays[] = { milliseconds(3), milliseconds(300), milliseconds(70000), hours(30), hours(24 * 60) };
+			for (std::uint32_t i = 0; i < 5; ++i)
+			{
+				wheel.Insert(i, start + delays[i], start);
+			}
+			Assert::AreEqual(5U, wheel.Size());
+
+			std::vector<std::uint32_t> expired;
+			auto expire = [&expired](std::uint32_t item) { expired.push_back(item); };
+			for (std::uint32_t i = 0; i < 5; ++i)
+			{
+				Assert::IsTrue(wheel.NextExpiryTime() == start + delays[i]);
+
+				// Nothing comes out until its expiry time has passed
+				wheel.Advance(start + delays[i], expire);
+				Assert::AreEqual(i, static_cast<std::uint32_t>(expired.size()));
+
+				wheel.Advance(start + delays[i] + microseconds(1), expire);
+				Assert::AreEqual(i + 1, static_cast<std::uint32_t>(expired.size()));
+				Assert::AreEqual(i, expired.back());
+			}
+			Assert::IsTrue(wheel.IsEmpty());
+
+			// Items already due come out on the next Advance
+			wheel.Insert(7, start, start + hours(24 * 61));
+			wheel.Advance(start + hours(24 * 61), expire);
+			Assert::AreEqual(7U, expired.back());
+		}
+
+		TEST_METHOD(TimingWheelTestRandom)
+		{
+			// The wheel hands out the same items as a brute-force scan, whatever the step size
+			TimingWheel<std::uint32_t> wheel;
+			std::vector<TimingWheel<std::uint32_t>::TimePoint> expiries;
+			std::vector<bool> isExpired;
+			auto currentTime = high_resolution_clock::now();
+			std::uint64_t random = 12345;
+			auto next = [&random](std::uint64_t range) { random = random * 6364136223846793005ULL + 1442695040888963407ULL; return (random >> 33) % range; };
+
+			for (std::uint32_t round = 0; round < 200; ++round)
+			{
+				for (std::uint32_t i = 0; i < 20; ++i)
+				{
+					const std::uint64_t scale[] = { 1000ULL, 1000000ULL, 1000000000ULL, 10000000000000ULL };
+					const auto expiry = currentTime + microseconds(next(scale[next(4)]));
+					wheel.Insert(static_cast<std::uint32_t>(expiries.size()), expiry, currentTime);
+					expiries.push_back(expiry);
+					isExpired.push_back(false);
+				}
+
+				const std::uint64_t steps[] = { 500ULL, 5000000ULL, 50000000000ULL };
+				currentTime += microseconds(next(steps[next(3)]));
+				wheel.Advance(currentTime, [&](std::uint32_t item)
+				{
+					Assert::IsFalse(isExpired[item]);
+					Assert::IsTrue(currentTime > expiries[item]);
+					isExpired[item] = true;
+				});
+
+				std::uint32_t pending = 0;
+				auto nextExpiry = TimingWheel<std::uint32_t>::TimePoint::max();
+				for (std::uint32_t item = 0; item < expiries.size(); ++item)
+				{
+					Assert::IsTrue(isExpired[item] == (currentTime > expiries[item]));
+					if (!isExpired[item])
+					{
+						++pending;
+						if (expiries[item] < nextExpiry)
+						{
+							nextExpiry = expiries[item];
+						}
+					}
+				}
+				Assert::AreEqual(pending, wheel.Size());
+				Assert::IsTrue(nextExpiry == wheel.NextExpiryTime());
+			}
+		}
+
+		TEST_METHOD(TimingWheelTestCopyMoveClear)
+		{
+			const auto start = high_resolution_clock::now();
+			TimingWheel<std::uint32_t> wheel;
+			for (std::uint32_t i = 0; i < 100; ++i)
+			{
+				wheel.Insert(i, start + milliseconds(i * 100), start);
+			}
+
+			TimingWheel<std::uint32_t> copiedWheel = wheel;
+			TimingWheel<std::uint32_t> movedWheel = std::move(wheel);
+			Assert::IsTrue(wheel.IsEmpty());
+			Assert::AreEqual(100U, copiedWheel.Size());
+			Assert::AreEqual(100U, movedWheel.Size());
+
+			std::uint32_t copiedCount = 0;
+			std::uint32_t movedCount = 0;
+			copiedWheel.Advance(start + seconds(5), [&copiedCount](std::uint32_t) { ++copiedCount; });
+			movedWheel.Advance(start + seconds(5), [&movedCount](std::uint32_t) { ++movedCount; });
+			Assert::AreEqual(50U, copiedCount);
+			Assert::AreEqual(50U, movedCount);
+
+			wheel = std::move(movedWheel);
+			Assert::AreEqual(50U, wheel.Size());
+			Assert::IsTrue(movedWheel.IsEmpty());
+
+			wheel.Clear();
+			Assert::IsTrue(wheel.IsEmpty());
+			Assert::IsTrue(wheel.NextExpiryTime() == TimingWheel<std::uint32_t>::TimePoint::max());
+			wheel.Advance(start + hours(1), [](std::uint32_t) { Assert::Fail(); });
+		}
+
+		private:
+#if defined(DEBUG) | defined(_DEBUG)
+			static _CrtMemState sStartMemState;
+#endif
+
+	};
+
+#if defined(DEBUG) | defined(_DEBUG)
+	_CrtMemState TimingWheelTest::sStartMemState;
+#endif
+
+}
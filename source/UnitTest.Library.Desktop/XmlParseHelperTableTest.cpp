@@ -11,6 +11,15 @@ namespace UnitTestLibraryDesktop
 	public:
 
 #if defined(DEBUG) | defined(_DEBUG)
+		TEST_CLASS_INITIALIZE(InitializeClass)
+		{
+			// The names in Content/Scope.xml stay interned after the first parse, so intern them before any leak checkpoint
+			for (const char* name : { "GlobalScope", "globalInt", "globalFloat", "globalVector", "globalMatrix", "globalString", "ParentScopeA", "ChildScopeA1", "ScopeB", "ChildScopeB1", "GrandchildScope" })
+			{
+				Symbol symbol(name);
+			}
+		}
+
 		TEST_METHOD_INITIALIZE(Initialize)
 		{
 			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
@@ -6,6 +6,7 @@
 #include <windows.h>
 #include <chrono>
 #include <thread>
+#include <future>
 
 // Headers needed for memory leak testing
 #if defined(DEBUG) || defined(_DEBUG)
@@ -16,11 +17,18 @@
 
 #include "glm/glm.hpp"
 
+#include "Allocator.h"
+#include "SystemAllocator.h"
+#include "LinearAllocator.h"
+#include "Pool.h"
+#include "PoolAllocator.h"
 #include "SList.h"
 #include "Vector.h"
 #include "Stack.h"
 #include "HashMap.h"
+#include "Symbol.h"
 
+#include "Span.h"
 #include "Datum.h"
 #include "XmlParseMaster.h"
 